@@ -125,6 +125,18 @@ namespace ArView
 		/// </summary>
 		void handleRightClick();
 
+		/// <summary>
+		/// Takes back the last move of the game.
+		/// </summary>
+		/// <returns>True if a move was taken back, false if there was no move to take back</returns>
+		bool undoMove();
+
+		/// <summary>
+		/// Plays the last move taken back again.
+		/// </summary>
+		/// <returns>True if a move was played again, false if there was no move to redo</returns>
+		bool redoMove();
+
 	private:
 		struct Impl;
 		std::unique_ptr<Impl> m_pImpl;
@@ -41,6 +41,13 @@ namespace Controller
 		/// </returns>
 		std::shared_ptr<Model::Piece const> getSelectedPiece() const;
 
+		/// <summary>
+		/// Gets the legal moves of the piece at the selected position. They come from the
+		/// game's legal moves, which are only generated once for each position.
+		/// </summary>
+		/// <returns>The legal moves of the selected piece, or no moves if no piece is selected</returns>
+		Model::MoveList getSelectedPieceLegalMoves() const;
+
 		/// <summary>
 		/// Selects the specified position. This may result in a piece
 		/// being moved if the selected position is a legal move for
@@ -54,6 +61,19 @@ namespace Controller
 		/// </summary>
 		void unselectPosition();
 
+		/// <summary>
+		/// Takes back the last move, for example one made by a misread gesture.
+		/// Any selected position is unselected.
+		/// </summary>
+		/// <returns>True if a move was taken back, false if there was no move to take back</returns>
+		bool undoMove();
+
+		/// <summary>
+		/// Plays the last move taken back again. Any selected position is unselected.
+		/// </summary>
+		/// <returns>True if a move was played again, false if there was no move to redo</returns>
+		bool redoMove();
+
 	private:
 		struct Impl;
 		std::unique_ptr<Impl> m_pImpl;
@@ -5,4 +5,8 @@
 
 #pragma once
 
+#if defined(_MSC_VER)
 #define EXPORT _declspec(dllexport)
+#else
+#define EXPORT __attribute__((visibility("default")))
+#endif
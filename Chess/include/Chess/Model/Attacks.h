@@ -0,0 +1,119 @@
+// Author:	Liam Scholte
+// Created:	10/17/2026 1:37:05 PM
+// This file contains lookup tables for the squares attacked by each type of piece
+
+#pragma once
+
+#include <Chess/Macros.h>
+#include <Chess/Model/Bitboard.h>
+
+#include <array>
+#include <cstddef>
+
+namespace Chess
+{
+namespace Model
+{
+	namespace Detail
+	{
+		/// <summary>
+		/// Builds a table of the squares reached from every square by a set of single step offsets.
+		/// Steps that would leave the board are discarded.
+		/// </summary>
+		template <std::size_t N>
+		constexpr std::array<Bitboard, SQUARE_COUNT> generateStepAttacks(int const (&rankOffsets)[N], int const (&fileOffsets)[N])
+		{
+			std::array<Bitboard, SQUARE_COUNT> attacks{};
+			for (int square = 0; square < SQUARE_COUNT; ++square)
+			{
+				for (std::size_t i = 0; i < N; ++i)
+				{
+					int rank = square / 8 + rankOffsets[i];
+					int file = square % 8 + fileOffsets[i];
+					if (rank >= 0 && rank < 8 && file >= 0 && file < 8)
+					{
+						attacks[square] |= Bitboard(1) << (rank * 8 + file);
+					}
+				}
+			}
+			return attacks;
+		}
+
+		int constexpr KNIGHT_RANK_OFFSETS[] = { 2, 2, -2, -2, 1, -1, 1, -1 };
+		int constexpr KNIGHT_FILE_OFFSETS[] = { -1, 1, -1, 1, -2, -2, 2, 2 };
+
+		int constexpr KING_RANK_OFFSETS[] = { 1, 1, 0, -1, -1, -1, 0, 1 };
+		int constexpr KING_FILE_OFFSETS[] = { 0, 1, 1, 1, 0, -1, -1, -1 };
+
+		int constexpr WHITE_PAWN_RANK_OFFSETS[] = { 1, 1 };
+		int constexpr BLACK_PAWN_RANK_OFFSETS[] = { -1, -1 };
+		int constexpr PAWN_FILE_OFFSETS[] = { -1, 1 };
+	}
+
+	/// <summary>
+	/// The squares attacked by a knight on each square.
+	/// </summary>
+	inline constexpr std::array<Bitboard, SQUARE_COUNT> KNIGHT_ATTACKS =
+		Detail::generateStepAttacks(Detail::KNIGHT_RANK_OFFSETS, Detail::KNIGHT_FILE_OFFSETS);
+
+	/// <summary>
+	/// The squares attacked by a king on each square, not including castling.
+	/// </summary>
+	inline constexpr std::array<Bitboard, SQUARE_COUNT> KING_ATTACKS =
+		Detail::generateStepAttacks(Detail::KING_RANK_OFFSETS, Detail::KING_FILE_OFFSETS);
+
+	/// <summary>
+	/// The squares attacked diagonally by a pawn on each square, indexed by color (0 = white, 1 = black).
+	/// </summary>
+	inline constexpr std::array<Bitboard, SQUARE_COUNT> PAWN_ATTACKS[2] =
+	{
+		Detail::generateStepAttacks(Detail::WHITE_PAWN_RANK_OFFSETS, Detail::PAWN_FILE_OFFSETS),
+		Detail::generateStepAttacks(Detail::BLACK_PAWN_RANK_OFFSETS, Detail::PAWN_FILE_OFFSETS)
+	};
+
+	/// <summary>
+	/// Gets the squares attacked by a rook, stopping at (and including) the first occupied square in each direction.
+	/// Uses magic bitboards, or the PEXT instruction when compiled with BMI2 support.
+	/// </summary>
+	/// <param name="square">The square of the rook</param>
+	/// <param name="occupancy">The occupied squares on the board</param>
+	/// <returns>The squares attacked by the rook</returns>
+	EXPORT Bitboard getRookAttacks(Square square, Bitboard occupancy);
+
+	/// <summary>
+	/// Gets the squares attacked by a bishop, stopping at (and including) the first occupied square in each direction.
+	/// Uses magic bitboards, or the PEXT instruction when compiled with BMI2 support.
+	/// </summary>
+	/// <param name="square">The square of the bishop</param>
+	/// <param name="occupancy">The occupied squares on the board</param>
+	/// <returns>The squares attacked by the bishop</returns>
+	EXPORT Bitboard getBishopAttacks(Square square, Bitboard occupancy);
+
+	/// <summary>
+	/// Gets the squares strictly between two squares that share a rank, file or diagonal.
+	/// </summary>
+	/// <param name="from">The first square</param>
+	/// <param name="to">The second square</param>
+	/// <returns>The squares between the two squares, or an empty bitboard if they are not aligned</returns>
+	EXPORT Bitboard getSquaresBetween(Square from, Square to);
+
+	/// <summary>
+	/// Gets the whole rank, file or diagonal running through two squares, from one edge of the board to the other.
+	/// </summary>
+	/// <param name="from">The first square</param>
+	/// <param name="to">The second square</param>
+	/// <returns>The line through both squares, or an empty bitboard if they are not aligned</returns>
+	EXPORT Bitboard getLine(Square from, Square to);
+
+	/// <summary>
+	/// Gets the squares attacked by a queen, stopping at (and including) the first occupied square in each direction.
+	/// </summary>
+	/// <param name="square">The square of the queen</param>
+	/// <param name="occupancy">The occupied squares on the board</param>
+	/// <returns>The squares attacked by the queen</returns>
+	inline Bitboard getQueenAttacks(Square square, Bitboard occupancy)
+	{
+		return getRookAttacks(square, occupancy) | getBishopAttacks(square, occupancy);
+	}
+}
+}
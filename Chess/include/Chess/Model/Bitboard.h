@@ -0,0 +1,115 @@
+// Author:	Liam Scholte
+// Created:	10/17/2026 9:04:12 AM
+// This file contains the definition of Bitboard and related helpers
+
+#pragma once
+
+#include <Chess/Model/Position.h>
+
+#include <cstdint>
+
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+
+namespace Chess
+{
+namespace Model
+{
+	/// <summary>
+	/// A set of squares on a chessboard with one bit per square.
+	/// Bit 0 corresponds to rank 1 file 1 and bit 63 corresponds to rank 8 file 8.
+	/// </summary>
+	using Bitboard = std::uint64_t;
+
+	/// <summary>
+	/// The index of a square on a chessboard in the range [0, 63].
+	/// </summary>
+	using Square = unsigned char;
+
+	Square constexpr SQUARE_COUNT = 64;
+
+	/// <summary>
+	/// Stands in for a square where there may be none, such as a missing en passant target.
+	/// </summary>
+	Square constexpr NO_SQUARE = SQUARE_COUNT;
+
+	Bitboard constexpr EMPTY_BITBOARD = 0;
+	Bitboard constexpr FULL_BITBOARD = ~EMPTY_BITBOARD;
+
+	/// <summary>
+	/// Converts a position on the board into a square index.
+	/// The position is assumed to be on the board.
+	/// </summary>
+	/// <param name="position">The position to convert</param>
+	/// <returns>The square index of the position</returns>
+	inline Square toSquare(Position position)
+	{
+		return static_cast<Square>((position.rank - 1) * 8 + (position.file - 1));
+	}
+
+	/// <summary>
+	/// Converts a square index into a position on the board.
+	/// </summary>
+	/// <param name="square">The square index to convert</param>
+	/// <returns>The position of the square</returns>
+	inline Position toPosition(Square square)
+	{
+		return Position(square / 8 + 1, square % 8 + 1);
+	}
+
+	/// <summary>
+	/// Gets a bitboard containing only the specified square.
+	/// </summary>
+	/// <param name="square">The square to set</param>
+	/// <returns>A bitboard with a single bit set</returns>
+	inline Bitboard constexpr toBitboard(Square square)
+	{
+		return Bitboard(1) << square;
+	}
+
+	/// <summary>
+	/// Counts the number of squares in a bitboard.
+	/// </summary>
+	/// <param name="bitboard">The bitboard to count</param>
+	/// <returns>The number of set bits</returns>
+	inline int popCount(Bitboard bitboard)
+	{
+#if defined(_MSC_VER)
+		return static_cast<int>(__popcnt64(bitboard));
+#else
+		return __builtin_popcountll(bitboard);
+#endif
+	}
+
+	/// <summary>
+	/// Gets the lowest square in a bitboard.
+	/// The bitboard must not be empty.
+	/// </summary>
+	/// <param name="bitboard">The non-empty bitboard</param>
+	/// <returns>The index of the least significant set bit</returns>
+	inline Square lowestSquare(Bitboard bitboard)
+	{
+#if defined(_MSC_VER)
+		unsigned long index;
+		_BitScanForward64(&index, bitboard);
+		return static_cast<Square>(index);
+#else
+		return static_cast<Square>(__builtin_ctzll(bitboard));
+#endif
+	}
+
+	/// <summary>
+	/// Removes the lowest square from a bitboard and returns it.
+	/// The bitboard must not be empty.
+	/// </summary>
+	/// <param name="bitboard">The non-empty bitboard to modify</param>
+	/// <returns>The index of the square that was removed</returns>
+	inline Square popLowestSquare(Bitboard& bitboard)
+	{
+		Square square = lowestSquare(bitboard);
+		bitboard &= bitboard - 1;
+		return square;
+	}
+}
+}
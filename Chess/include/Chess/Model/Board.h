@@ -6,14 +6,39 @@
 
 #include <Chess/Macros.h>
 #include <Chess/Model/FwdDecl.h>
+#include <Chess/Model/Bitboard.h>
+#include <Chess/Model/MoveList.h>
 
 #include <unordered_set>
 #include <memory>
+#include <cstddef>
+#include <string>
+#include <string_view>
 
 namespace Chess
 {
 namespace Model
 {
+	/// <summary>
+	/// Bit flags for the castling rights that remain in a position.
+	/// </summary>
+	unsigned char constexpr NO_CASTLING = 0;
+	unsigned char constexpr WHITE_KINGSIDE_CASTLING = 1;
+	unsigned char constexpr WHITE_QUEENSIDE_CASTLING = 2;
+	unsigned char constexpr BLACK_KINGSIDE_CASTLING = 4;
+	unsigned char constexpr BLACK_QUEENSIDE_CASTLING = 8;
+	unsigned char constexpr ALL_CASTLING = 15;
+
+	/// <summary>
+	/// The size of a buffer that can hold any position in Forsyth-Edwards Notation, including the null terminator.
+	/// </summary>
+	std::size_t constexpr MAX_FEN_LENGTH = 128;
+
+	/// <summary>
+	/// The starting position of a game in Forsyth-Edwards Notation.
+	/// </summary>
+	std::string_view constexpr START_FEN = "rnbqkbnr/pppppppp/8/8/8/8/PPPPPPPP/RNBQKBNR w KQkq - 0 1";
+
 	/// <summary>
 	/// Represents an 8x8 chessboard that can hold various chess pieces.
 	/// </summary>
@@ -28,13 +53,33 @@ namespace Model
 		Board();
 
 		/// <summary>
-		/// Constructs a board from a deep copy of an existing board
+		/// Constructs a board from a position in Forsyth-Edwards Notation.
+		/// Missing castling and en passant fields are treated as "-", and missing move counters as "0 1".
+		/// The FEN is parsed in place without allocating memory apart from the board itself.
+		/// Positions that cannot arise in a game are rejected: each side must have exactly one king,
+		/// at most 16 pieces and at most 8 pawns, no pawn may stand on the first or last rank,
+		/// and the side not to move must not be in check.
+		/// </summary>
+		/// <param name="fen">The position in Forsyth-Edwards Notation</param>
+		/// <exception cref="std::invalid_argument">Thrown if any of the fields are malformed or the position cannot arise in a game</exception>
+		explicit Board(std::string_view fen);
+
+		/// <summary>
+		/// Constructs a board from a deep copy of an existing board.
+		/// The pieces are stored by value, so the copy allocates the position and, if a neural network
+		/// is set, a copy of its accumulator.
 		/// </summary>
 		/// <param name="otherBoard">The existing board to deep copy</param>
 		Board(Board const& otherBoard);
 
 		virtual ~Board();
 
+		/// <summary>
+		/// Determines if it is white or black to move next.
+		/// </summary>
+		/// <returns>True if white is to move next, false if black</returns>
+		bool isWhiteMove() const;
+
 		/// <summary>
 		/// Gets the dimensions of the board.
 		/// </summary>
@@ -42,25 +87,169 @@ namespace Model
 		Size getSize() const;
 
 		/// <summary>
-		/// Gets all of the pieces on the board.
+		/// Gets the castling rights that remain in this position. A right is only lost when the king
+		/// or rook moves (or the rook is captured), so having a right does not mean castling is currently possible.
+		/// </summary>
+		/// <returns>The castling rights as a combination of the castling bit flags</returns>
+		unsigned char getCastlingRights() const;
+
+		/// <summary>
+		/// Gets the square a pawn skipped over with a double push on the previous move.
+		/// It is only recorded if an opposing pawn stands ready to capture en passant,
+		/// so that positions that cannot be told apart also hash the same.
+		/// </summary>
+		/// <returns>The en passant target square, or NO_SQUARE if there is none</returns>
+		Square getEnPassantSquare() const;
+
+		/// <summary>
+		/// Gets the number of halfmoves since the last capture or pawn move, for the fifty-move rule.
+		/// </summary>
+		/// <returns>The halfmove clock</returns>
+		unsigned int getHalfmoveClock() const;
+
+		/// <summary>
+		/// Gets the number of the current full move, which starts at 1 and increases after each black move.
+		/// </summary>
+		/// <returns>The fullmove number</returns>
+		unsigned int getFullmoveNumber() const;
+
+		/// <summary>
+		/// Replaces the position on this board with a position in Forsyth-Edwards Notation.
+		/// The FEN is checked as in Board(std::string_view), and the board is left unchanged
+		/// if it is rejected. Any neural network is kept.
+		/// </summary>
+		/// <param name="fen">The position in Forsyth-Edwards Notation</param>
+		/// <exception cref="std::invalid_argument">Thrown if any of the fields are malformed or the position cannot arise in a game</exception>
+		void setFen(std::string_view fen);
+
+		/// <summary>
+		/// Writes this position in Forsyth-Edwards Notation without allocating memory.
+		/// The en passant field only names a target that can actually be captured on.
+		/// </summary>
+		/// <param name="buffer">Receives the null terminated FEN</param>
+		/// <returns>The length of the FEN, not counting the null terminator</returns>
+		std::size_t writeFen(char (&buffer)[MAX_FEN_LENGTH]) const;
+
+		/// <summary>
+		/// Gets this position in Forsyth-Edwards Notation.
+		/// </summary>
+		/// <returns>The position in Forsyth-Edwards Notation</returns>
+		std::string toFen() const;
+
+		/// <summary>
+		/// Gets the Zobrist hash of this position, covering the pieces, side to move, castling rights
+		/// and en passant target. The hash is updated incrementally as the board changes.
+		/// </summary>
+		/// <returns>The 64-bit hash of this position</returns>
+		std::uint64_t getHash() const;
+
+		/// <summary>
+		/// Gets the Zobrist hash of the pawns alone, which keys the pawn structure evaluation.
+		/// It is 0 when there are no pawns on the board.
+		/// </summary>
+		/// <returns>The 64-bit hash of the pawns in this position</returns>
+		std::uint64_t getPawnHash() const;
+
+		/// <summary>
+		/// Statically evaluates this position with the neural network if one is set.
+		/// Otherwise the material and piece-square terms, which are kept up to date incrementally
+		/// as the board changes, are blended between middlegame and endgame values by the material
+		/// left on the board, and pawn structure and the mobility of the pieces are added on top.
+		/// </summary>
+		/// <returns>The score in centipawns from the side to move's point of view</returns>
+		int evaluate() const;
+
+		/// <summary>
+		/// Statically evaluates this position like evaluate(), but looks up the pawn structure
+		/// in a pawn hash table instead of evaluating it from scratch.
+		/// </summary>
+		/// <param name="pawnHashTable">The table of pawn structure evaluations, which must not be shared with other threads</param>
+		/// <returns>The score in centipawns from the side to move's point of view</returns>
+		int evaluate(PawnHashTable& pawnHashTable) const;
+
+		/// <summary>
+		/// Sets the neural network used to evaluate this position. The network's accumulator is
+		/// rebuilt once here and then updated incrementally as pieces are added, removed and moved.
+		/// Copies of the board share the network.
+		/// </summary>
+		/// <param name="pNetwork">The network to use, or nullptr to use the hand-written evaluation</param>
+		void setNeuralNetwork(std::shared_ptr<NeuralNetwork const> pNetwork);
+
+		/// <summary>
+		/// Gets the neural network used to evaluate this position.
+		/// </summary>
+		/// <returns>The network, or nullptr if the hand-written evaluation is used</returns>
+		std::shared_ptr<NeuralNetwork const> const& getNeuralNetwork() const;
+
+		/// <summary>
+		/// Gets all of the pieces on the board. The board stores its pieces as PieceCodes, so the
+		/// pieces returned are views created by each call. A view keeps the position the piece had
+		/// when it was created.
 		/// </summary>
 		/// <returns>All of the pieces on the board</returns>
-		std::unordered_set<std::shared_ptr<Piece>> const& getPieces() const;
+		std::unordered_set<std::shared_ptr<Piece>> getPieces() const;
 
 		/// <summary>
 		/// Gets all of the pieces of the specified color on the board.
 		/// </summary>
 		/// <param name="isWhite">Whether to get white or black pieces</param>
 		/// <returns>All of the pieces of the specified color on the board</returns>
-		std::unordered_set<std::shared_ptr<Piece>> const& getPieces(bool isWhite) const;
+		std::unordered_set<std::shared_ptr<Piece>> getPieces(bool isWhite) const;
 
 		/// <summary>
 		/// Gets the piece at the specified position.
 		/// </summary>
 		/// <param name="position">The position to search for a piece</param>
-		/// <returns>The piece at the position or nullptr if no piece exists</returns>
+		/// <returns>A view of the piece at the position or nullptr if no piece exists</returns>
 		std::shared_ptr<Piece> getPiece(Position position) const;
 
+		/// <summary>
+		/// Gets the piece on a square by value, without creating a view of it.
+		/// </summary>
+		/// <param name="square">The square to look at</param>
+		/// <returns>The piece on the square, or an empty code if the square is empty</returns>
+		PieceCode getPieceCode(Square square) const;
+
+		/// <summary>
+		/// Gets the squares occupied by any piece.
+		/// </summary>
+		/// <returns>A bitboard of all occupied squares</returns>
+		Bitboard getOccupancy() const;
+
+		/// <summary>
+		/// Gets the squares occupied by pieces of the specified color.
+		/// </summary>
+		/// <param name="isWhite">Whether to get squares of white or black pieces</param>
+		/// <returns>A bitboard of the squares occupied by the specified color</returns>
+		Bitboard getOccupancy(bool isWhite) const;
+
+		/// <summary>
+		/// Gets the squares occupied by pieces of the specified color and type.
+		/// </summary>
+		/// <param name="isWhite">Whether to get squares of white or black pieces</param>
+		/// <param name="type">The type of piece</param>
+		/// <returns>A bitboard of the squares occupied by the specified pieces</returns>
+		Bitboard getBitboard(bool isWhite, PieceType type) const;
+
+		/// <summary>
+		/// Gets the pieces of a color that attack a square, given a particular occupancy of the board.
+		/// Passing an occupancy other than getOccupancy() allows x-ray and hypothetical queries.
+		/// </summary>
+		/// <param name="square">The square being attacked</param>
+		/// <param name="byWhite">Whether to find white or black attackers</param>
+		/// <param name="occupancy">The occupied squares that block sliding pieces</param>
+		/// <returns>A bitboard of the squares of the attacking pieces</returns>
+		Bitboard getAttackers(Square square, bool byWhite, Bitboard occupancy) const;
+
+		/// <summary>
+		/// Moves the piece at a position to a new position without checking if the move is legal.
+		/// Any piece already at the new position is removed from the board.
+		/// </summary>
+		/// <param name="currentPosition">The position of the piece to move</param>
+		/// <param name="newPosition">The position to move the piece to</param>
+		/// <returns>True if a piece was moved, false if there is no piece at the current position</returns>
+		bool movePiece(Position currentPosition, Position newPosition);
+
 		/// <summary>
 		/// Removes the specified piece from the board.
 		/// </summary>
@@ -102,6 +291,81 @@ namespace Model
 		/// <returns>True if the king is in check, false otherwise</returns>
 		bool isKingInCheck(bool isWhite) const;
 
+		/// <summary>
+		/// Gets every square attacked by pieces of a color, including squares occupied by that color's own pieces.
+		/// The attack maps are maintained incrementally as pieces move, so this is a constant time lookup.
+		/// </summary>
+		/// <param name="byWhite">Whether to get the squares attacked by white or black</param>
+		/// <returns>A bitboard of the attacked squares</returns>
+		Bitboard getAttackedSquares(bool byWhite) const;
+
+		/// <summary>
+		/// Gets the number of pieces of a color that attack a square.
+		/// </summary>
+		/// <param name="square">The square being attacked</param>
+		/// <param name="byWhite">Whether to count white or black attackers</param>
+		/// <returns>The number of attackers of the square</returns>
+		int getAttackerCount(Square square, bool byWhite) const;
+
+		/// <summary>
+		/// Determines if any piece of a color attacks a square.
+		/// </summary>
+		/// <param name="square">The square being attacked</param>
+		/// <param name="byWhite">Whether to check for white or black attackers</param>
+		/// <returns>True if the square is attacked, false otherwise</returns>
+		bool isSquareAttacked(Square square, bool byWhite) const;
+
+		/// <summary>
+		/// Statically evaluates the exchange a move starts on its target square. Both sides keep recapturing
+		/// with their least valuable attacker, including pieces revealed behind earlier attackers, and either
+		/// side may stop when continuing would lose material. No moves are made and pins are not considered.
+		/// </summary>
+		/// <param name="move">The move that starts the exchange, usually a capture</param>
+		/// <returns>The material the moving side gains in centipawns, which is negative if the move loses material</returns>
+		int see(Move move) const;
+
+		/// <summary>
+		/// Makes a move in place without checking if it is legal and passes the turn to the other color.
+		/// Any piece at the destination is captured, and a pawn reaching the last rank is promoted.
+		/// A king moving two squares castles, and a pawn moving diagonally onto an empty square captures en passant,
+		/// so these are recognised from the board even if the move's flag does not say so.
+		/// The move can be taken back by passing the filled in undo record to unmakeMove.
+		/// This does not allocate any memory.
+		/// </summary>
+		/// <param name="move">The move to make</param>
+		/// <param name="undoRecord">Receives the information needed to take back the move</param>
+		/// <returns>True if the move was made, false if there is no piece to move</returns>
+		bool makeMove(Move move, UndoRecord& undoRecord);
+
+		/// <summary>
+		/// Takes back the most recent move made with makeMove, restoring the board
+		/// to exactly the state it was in before the move.
+		/// </summary>
+		/// <param name="move">The move that was made</param>
+		/// <param name="undoRecord">The undo record filled in when the move was made</param>
+		void unmakeMove(Move move, UndoRecord const& undoRecord);
+
+		/// <summary>
+		/// Generates every legal move for the side to move.
+		/// Pinned pieces and checks are worked out once for the position,
+		/// so no move has to be tried on the board to see if it is legal.
+		/// </summary>
+		/// <returns>The legal moves for the side to move</returns>
+		MoveList generateLegalMoves() const;
+
+		/// <summary>
+		/// Generates the legal moves for the side to move that capture a piece.
+		/// </summary>
+		/// <returns>The legal captures for the side to move</returns>
+		MoveList generateLegalCaptures() const;
+
+		/// <summary>
+		/// Generates the legal moves of the piece at a position, whichever color it is.
+		/// </summary>
+		/// <param name="position">The position of the piece</param>
+		/// <returns>The legal moves of the piece, or no moves if there is no piece at the position</returns>
+		MoveList generateLegalMoves(Position position) const;
+
 
 	private:
 		struct Impl;
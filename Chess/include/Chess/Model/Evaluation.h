@@ -0,0 +1,248 @@
+// Author:	Liam Scholte
+// Created:	10/17/2026 5:34:20 PM
+// This file contains the terms used to evaluate a chess position
+
+#pragma once
+
+#include <Chess/Macros.h>
+#include <Chess/Model/Bitboard.h>
+
+#include <array>
+
+namespace Chess
+{
+namespace Model
+{
+	/// <summary>
+	/// A score with separate values for the middlegame and the endgame.
+	/// The two are blended according to how much material is left on the board.
+	/// </summary>
+	struct TaperedScore
+	{
+		int middlegame;
+		int endgame;
+
+		constexpr TaperedScore()
+			: middlegame(0)
+			, endgame(0)
+		{}
+
+		constexpr TaperedScore(int middlegame, int endgame)
+			: middlegame(middlegame)
+			, endgame(endgame)
+		{}
+
+		constexpr TaperedScore operator+(TaperedScore other) const
+		{
+			return TaperedScore(middlegame + other.middlegame, endgame + other.endgame);
+		}
+
+		constexpr TaperedScore operator-(TaperedScore other) const
+		{
+			return TaperedScore(middlegame - other.middlegame, endgame - other.endgame);
+		}
+
+		constexpr TaperedScore operator*(int factor) const
+		{
+			return TaperedScore(middlegame * factor, endgame * factor);
+		}
+
+		TaperedScore& operator+=(TaperedScore other)
+		{
+			middlegame += other.middlegame;
+			endgame += other.endgame;
+			return *this;
+		}
+
+		TaperedScore& operator-=(TaperedScore other)
+		{
+			middlegame -= other.middlegame;
+			endgame -= other.endgame;
+			return *this;
+		}
+	};
+
+	/// <summary>
+	/// How much each type of piece counts towards the game phase, indexed by PieceType.
+	/// With all pieces on the board the phase is MAX_PHASE, and it falls towards 0 as pieces are traded.
+	/// </summary>
+	int constexpr PHASE_WEIGHTS[6] = { 0, 2, 1, 1, 4, 0 };
+	int constexpr MAX_PHASE = 24;
+
+	/// <summary>
+	/// The value of each type of piece when trading material, indexed by PieceType.
+	/// The king is worth more than all of the other pieces together so that it is never traded.
+	/// </summary>
+	int constexpr EXCHANGE_VALUES[6] = { 100, 500, 320, 330, 900, 20000 };
+
+	/// <summary>
+	/// Blends a tapered score into a single score for a game phase.
+	/// </summary>
+	/// <param name="score">The score to blend</param>
+	/// <param name="phase">The game phase, which is clamped to MAX_PHASE</param>
+	/// <returns>The blended score</returns>
+	inline int taper(TaperedScore score, int phase)
+	{
+		phase = phase < MAX_PHASE ? phase : MAX_PHASE;
+		return (score.middlegame * phase + score.endgame * (MAX_PHASE - phase)) / MAX_PHASE;
+	}
+
+	namespace Detail
+	{
+		TaperedScore constexpr PIECE_VALUES[6] =
+		{
+			{ 100, 120 }, { 500, 540 }, { 320, 300 }, { 330, 310 }, { 900, 950 }, { 0, 0 }
+		};
+
+		//Bonuses for each square from white's point of view, laid out as the board is seen
+		//from white's side with rank 8 on the first row
+		int constexpr PAWN_SQUARES[SQUARE_COUNT] =
+		{
+			  0,   0,   0,   0,   0,   0,   0,   0,
+			 50,  50,  50,  50,  50,  50,  50,  50,
+			 10,  10,  20,  30,  30,  20,  10,  10,
+			  5,   5,  10,  25,  25,  10,   5,   5,
+			  0,   0,   0,  20,  20,   0,   0,   0,
+			  5,  -5, -10,   0,   0, -10,  -5,   5,
+			  5,  10,  10, -20, -20,  10,  10,   5,
+			  0,   0,   0,   0,   0,   0,   0,   0
+		};
+
+		int constexpr KNIGHT_SQUARES[SQUARE_COUNT] =
+		{
+			-50, -40, -30, -30, -30, -30, -40, -50,
+			-40, -20,   0,   0,   0,   0, -20, -40,
+			-30,   0,  10,  15,  15,  10,   0, -30,
+			-30,   5,  15,  20,  20,  15,   5, -30,
+			-30,   0,  15,  20,  20,  15,   0, -30,
+			-30,   5,  10,  15,  15,  10,   5, -30,
+			-40, -20,   0,   5,   5,   0, -20, -40,
+			-50, -40, -30, -30, -30, -30, -40, -50
+		};
+
+		int constexpr BISHOP_SQUARES[SQUARE_COUNT] =
+		{
+			-20, -10, -10, -10, -10, -10, -10, -20,
+			-10,   0,   0,   0,   0,   0,   0, -10,
+			-10,   0,   5,  10,  10,   5,   0, -10,
+			-10,   5,   5,  10,  10,   5,   5, -10,
+			-10,   0,  10,  10,  10,  10,   0, -10,
+			-10,  10,  10,  10,  10,  10,  10, -10,
+			-10,   5,   0,   0,   0,   0,   5, -10,
+			-20, -10, -10, -10, -10, -10, -10, -20
+		};
+
+		int constexpr ROOK_SQUARES[SQUARE_COUNT] =
+		{
+			  0,   0,   0,   0,   0,   0,   0,   0,
+			  5,  10,  10,  10,  10,  10,  10,   5,
+			 -5,   0,   0,   0,   0,   0,   0,  -5,
+			 -5,   0,   0,   0,   0,   0,   0,  -5,
+			 -5,   0,   0,   0,   0,   0,   0,  -5,
+			 -5,   0,   0,   0,   0,   0,   0,  -5,
+			 -5,   0,   0,   0,   0,   0,   0,  -5,
+			  0,   0,   0,   5,   5,   0,   0,   0
+		};
+
+		int constexpr QUEEN_SQUARES[SQUARE_COUNT] =
+		{
+			-20, -10, -10,  -5,  -5, -10, -10, -20,
+			-10,   0,   0,   0,   0,   0,   0, -10,
+			-10,   0,   5,   5,   5,   5,   0, -10,
+			 -5,   0,   5,   5,   5,   5,   0,  -5,
+			  0,   0,   5,   5,   5,   5,   0,  -5,
+			-10,   5,   5,   5,   5,   5,   0, -10,
+			-10,   0,   5,   0,   0,   0,   0, -10,
+			-20, -10, -10,  -5,  -5, -10, -10, -20
+		};
+
+		//The king shelters behind its pawns in the middlegame and heads for the centre in the endgame
+		int constexpr KING_MIDDLEGAME_SQUARES[SQUARE_COUNT] =
+		{
+			-30, -40, -40, -50, -50, -40, -40, -30,
+			-30, -40, -40, -50, -50, -40, -40, -30,
+			-30, -40, -40, -50, -50, -40, -40, -30,
+			-30, -40, -40, -50, -50, -40, -40, -30,
+			-20, -30, -30, -40, -40, -30, -30, -20,
+			-10, -20, -20, -20, -20, -20, -20, -10,
+			 20,  20,   0,   0,   0,   0,  20,  20,
+			 20,  30,  10,   0,   0,  10,  30,  20
+		};
+
+		int constexpr KING_ENDGAME_SQUARES[SQUARE_COUNT] =
+		{
+			-50, -40, -30, -20, -20, -30, -40, -50,
+			-30, -20, -10,   0,   0, -10, -20, -30,
+			-30, -10,  20,  30,  30,  20, -10, -30,
+			-30, -10,  30,  40,  40,  30, -10, -30,
+			-30, -10,  30,  40,  40,  30, -10, -30,
+			-30, -10,  20,  30,  30,  20, -10, -30,
+			-30, -30,   0,   0,   0,   0, -30, -30,
+			-50, -30, -30, -30, -30, -30, -30, -50
+		};
+
+		/// <summary>
+		/// Combines the material value and square bonuses of each type of piece into one table indexed by Square.
+		/// Black's scores are white's scores on the square mirrored across the middle of the board, negated.
+		/// </summary>
+		constexpr std::array<std::array<std::array<TaperedScore, SQUARE_COUNT>, 6>, 2> generatePieceSquareScores()
+		{
+			int const* middlegameSquares[6] = { PAWN_SQUARES, ROOK_SQUARES, KNIGHT_SQUARES, BISHOP_SQUARES, QUEEN_SQUARES, KING_MIDDLEGAME_SQUARES };
+			int const* endgameSquares[6] = { PAWN_SQUARES, ROOK_SQUARES, KNIGHT_SQUARES, BISHOP_SQUARES, QUEEN_SQUARES, KING_ENDGAME_SQUARES };
+
+			std::array<std::array<std::array<TaperedScore, SQUARE_COUNT>, 6>, 2> scores{};
+			for (int type = 0; type < 6; ++type)
+			{
+				for (int square = 0; square < SQUARE_COUNT; ++square)
+				{
+					//The tables list rank 8 first, while square 0 is on rank 1
+					int whiteIndex = (7 - square / 8) * 8 + square % 8;
+					int blackIndex = (square / 8) * 8 + square % 8;
+					scores[0][type][square] = PIECE_VALUES[type] + TaperedScore(middlegameSquares[type][whiteIndex], endgameSquares[type][whiteIndex]);
+					scores[1][type][square] = TaperedScore() - PIECE_VALUES[type] - TaperedScore(middlegameSquares[type][blackIndex], endgameSquares[type][blackIndex]);
+				}
+			}
+			return scores;
+		}
+	}
+
+	/// <summary>
+	/// The material and placement score of a piece from white's point of view,
+	/// indexed by color (0 = white, 1 = black), then PieceType, then Square.
+	/// </summary>
+	inline constexpr std::array<std::array<std::array<TaperedScore, SQUARE_COUNT>, 6>, 2> PIECE_SQUARE_SCORES =
+		Detail::generatePieceSquareScores();
+
+	/// <summary>
+	/// The score per square a piece can move to beyond a typical number of squares, indexed by PieceType.
+	/// Pawns and kings are not scored for mobility.
+	/// </summary>
+	TaperedScore constexpr MOBILITY_WEIGHTS[6] = { { 0, 0 }, { 2, 4 }, { 4, 4 }, { 5, 5 }, { 1, 2 }, { 0, 0 } };
+	int constexpr MOBILITY_BASELINES[6] = { 0, 7, 4, 6, 13, 0 };
+
+	/// <summary>
+	/// The evaluation of the pawn structure, which only depends on where the pawns stand.
+	/// </summary>
+	struct EXPORT PawnEvaluation
+	{
+		/// <summary>
+		/// The score of the pawn structure from white's point of view.
+		/// </summary>
+		TaperedScore score;
+
+		/// <summary>
+		/// The passed pawns of each color, indexed by color (0 = white, 1 = black).
+		/// </summary>
+		Bitboard passedPawns[2];
+	};
+
+	/// <summary>
+	/// Scores the pawn structure from white's point of view, penalizing doubled
+	/// and isolated pawns and rewarding passed pawns by how far they have advanced.
+	/// </summary>
+	/// <param name="whitePawns">The squares of the white pawns</param>
+	/// <param name="blackPawns">The squares of the black pawns</param>
+	/// <returns>The score of the pawn structure and the passed pawns</returns>
+	EXPORT PawnEvaluation evaluatePawnStructure(Bitboard whitePawns, Bitboard blackPawns);
+}
+}
@@ -10,9 +10,25 @@ namespace Model
 {
 	class Game;
 	class Board;
+	class MemoryMappedFile;
+	class MoveList;
+	class NeuralNetwork;
+	class PawnHashTable;
+	class PositionHistory;
+	class Search;
+	class Tablebase;
+	class TranspositionTable;
 
 	struct Position;
 	struct Size;
+	class Move;
+	class PieceCode;
+	struct UndoRecord;
+	struct PawnEvaluation;
+	struct SearchLimits;
+	struct SearchResult;
+	struct TablebaseResult;
+	struct TranspositionEntry;
 
 	enum class PieceType;
 	class Piece;
@@ -6,8 +6,12 @@
 
 #include <Chess/Macros.h>
 #include <Chess/Model/FwdDecl.h>
+#include <Chess/Model/Search.h>
 
+#include <cstdint>
 #include <memory>
+#include <string>
+#include <string_view>
 
 namespace Chess
 {
@@ -24,6 +28,13 @@ namespace Model
 		/// </summary>
 		Game();
 
+		/// <summary>
+		/// Constructs a game of chess that resumes from a position in Forsyth-Edwards Notation.
+		/// </summary>
+		/// <param name="fen">The position in Forsyth-Edwards Notation</param>
+		/// <exception cref="std::invalid_argument">Thrown if the FEN is malformed</exception>
+		explicit Game(std::string_view fen);
+
 		virtual ~Game();
 
 		/// <summary>
@@ -38,6 +49,43 @@ namespace Model
 		/// <returns>The chessboard for this game of chess</returns>
 		Board const& getBoard() const;
 
+		/// <summary>
+		/// Gets the Zobrist hash of the current position.
+		/// </summary>
+		/// <returns>The 64-bit hash of the current position</returns>
+		std::uint64_t getHash() const;
+
+		/// <summary>
+		/// Replaces the current position with a position in Forsyth-Edwards Notation.
+		/// The position must be one that can arise in a game: each side must have exactly one king,
+		/// at most 16 pieces and at most 8 pawns, no pawn may stand on the first or last rank,
+		/// and the side not to move must not be in check. The game is left unchanged if the FEN is rejected.
+		/// </summary>
+		/// <param name="fen">The position in Forsyth-Edwards Notation</param>
+		/// <exception cref="std::invalid_argument">Thrown if the FEN is malformed or the position cannot arise in a game</exception>
+		void setFen(std::string_view fen);
+
+		/// <summary>
+		/// Gets the current position in Forsyth-Edwards Notation, for example to resume the game later.
+		/// </summary>
+		/// <returns>The current position in Forsyth-Edwards Notation</returns>
+		std::string toFen() const;
+
+		/// <summary>
+		/// Gets the legal moves for the side to move. They are generated once whenever the position changes and kept
+		/// until it changes again, so drawing, selecting and moving a piece share one generation and reading them never
+		/// modifies the game.
+		/// </summary>
+		/// <returns>The legal moves for the side to move</returns>
+		MoveList const& getLegalMoves() const;
+
+		/// <summary>
+		/// Gets the legal moves of the piece at a position. The moves of the side to move's pieces are taken from getLegalMoves().
+		/// </summary>
+		/// <param name="position">The position of the piece</param>
+		/// <returns>The legal moves of the piece, or no moves if there is no piece at the position</returns>
+		MoveList getLegalMoves(Position position) const;
+
 		/// <summary>
 		/// Attempts to move the piece from one position to a new position.
 		/// Movement may fail for reasons such as
@@ -52,6 +100,107 @@ namespace Model
 		/// <returns>True if the move was successfully completed, false otherwise</returns>
 		bool move(Position currentPosition, Position newPosition);
 
+		/// <summary>
+		/// Attempts to move the piece from one position to a new position, promoting a pawn
+		/// that reaches the last rank to the given piece. The other overload promotes to a queen.
+		/// </summary>
+		/// <param name="currentPosition">The initial position</param>
+		/// <param name="newPosition">The destination position</param>
+		/// <param name="promotion">The piece to promote to, which must be a queen, rook, bishop or knight</param>
+		/// <returns>True if the move was successfully completed, false otherwise</returns>
+		bool move(Position currentPosition, Position newPosition, PieceType promotion);
+
+		/// <summary>
+		/// Attempts to make a move, such as one read from a game record.
+		/// The move is only made if it is one of the legal moves for the side to move.
+		/// </summary>
+		/// <param name="move">The move to make</param>
+		/// <returns>True if the move was legal and has been made, false otherwise</returns>
+		bool move(Move move);
+
+		/// <summary>
+		/// Determines if there is a move to take back.
+		/// </summary>
+		/// <returns>True if a move has been made since the game started or its position was last set, false otherwise</returns>
+		bool canUndo() const;
+
+		/// <summary>
+		/// Determines if there is a move that was taken back and can be played again.
+		/// </summary>
+		/// <returns>True if a move can be redone, false otherwise</returns>
+		bool canRedo() const;
+
+		/// <summary>
+		/// Takes back the last move. Each move keeps a small undo record of what it captured and the
+		/// rights and clocks it replaced, so taking back a move costs the same however long the game is.
+		/// </summary>
+		/// <returns>True if a move was taken back, false if there was no move to take back</returns>
+		bool undo();
+
+		/// <summary>
+		/// Plays the last move taken back again. Making any other move discards the moves that could be redone.
+		/// </summary>
+		/// <returns>True if a move was played again, false if there was no move to redo</returns>
+		bool redo();
+
+		/// <summary>
+		/// Gets the positions reached in the game since it started or since the position was last set from a FEN.
+		/// </summary>
+		/// <returns>The positions of the game, ending with the current one</returns>
+		PositionHistory const& getPositionHistory() const;
+
+		/// <summary>
+		/// Determines if the current position has occurred three times, which makes the game a draw.
+		/// </summary>
+		/// <returns>True if the current position has occurred three times, false otherwise</returns>
+		bool isThreefoldRepetition() const;
+
+		/// <summary>
+		/// Determines if fifty moves have been played by each side without a capture or pawn move, which makes the game a draw.
+		/// </summary>
+		/// <returns>True if the fifty-move rule applies, false otherwise</returns>
+		bool isFiftyMoveDraw() const;
+
+		/// <summary>
+		/// Searches for the best move for the side to move, for example to offer a hint or to play as an opponent.
+		/// Results are kept in a transposition table owned by the game, so later searches build on earlier ones.
+		/// Lines that return to an earlier position of the game are scored as draws.
+		/// The table is only allocated by the first search, so games that are never searched stay small.
+		/// If an opening book is loaded and has moves for the position, one of them is played instead of searching.
+		/// If tablebases are loaded and cover the position, the move is read from them instead.
+		/// </summary>
+		/// <param name="limits">When to stop searching, such as a time budget per frame</param>
+		/// <returns>The best move found and the line of play expected to follow it</returns>
+		SearchResult findBestMove(SearchLimits const& limits);
+
+		/// <summary>
+		/// Loads a neural network to evaluate positions with in place of the hand-written evaluation.
+		/// </summary>
+		/// <param name="path">The path of the network file</param>
+		/// <exception cref="std::runtime_error">Thrown if the file is not a valid network</exception>
+		void loadNeuralNetwork(std::string const& path);
+
+		/// <summary>
+		/// Loads an opening book to choose moves from while the game is still in the book.
+		/// </summary>
+		/// <param name="path">The path of the book file</param>
+		/// <exception cref="std::runtime_error">Thrown if the file is not a valid opening book</exception>
+		void loadOpeningBook(std::string const& path);
+
+		/// <summary>
+		/// Loads the endgame tablebases in a directory, which are then used to play and score endgames perfectly.
+		/// </summary>
+		/// <param name="directory">The directory holding the table files</param>
+		/// <exception cref="std::runtime_error">Thrown if a table file is invalid</exception>
+		void loadTablebases(std::string const& directory);
+
+		/// <summary>
+		/// Looks up the current position in the loaded tablebases, for example to show how many moves remain until mate.
+		/// </summary>
+		/// <param name="result">Receives the outcome if the position is covered</param>
+		/// <returns>True if the position is covered by a loaded table, false otherwise</returns>
+		bool probeTablebase(TablebaseResult& result) const;
+
 	private:
 		struct Impl;
 		std::unique_ptr<Impl> m_pImpl;
@@ -0,0 +1,157 @@
+// Author:	Liam Scholte
+// Created:	10/17/2026 9:02:44 PM
+// This file contains the class definitions for GameRecordWriter and GameRecordReader,
+// which store games in a compact binary format
+
+#pragma once
+
+#include <Chess/Macros.h>
+#include <Chess/Model/FwdDecl.h>
+#include <Chess/Model/Move.h>
+
+#include <cstdint>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Chess
+{
+namespace Model
+{
+	/// <summary>
+	/// How a recorded game ended.
+	/// </summary>
+	enum class GameResult : std::uint8_t
+	{
+		Unknown, WhiteWins, BlackWins, Draw
+	};
+
+	/// <summary>
+	/// A view of one game in a game record file. It points into the mapped file,
+	/// so it is only valid while the reader it came from is alive.
+	/// </summary>
+	struct EXPORT RecordedGame
+	{
+		/// <summary>
+		/// The position the game started from in Forsyth-Edwards Notation,
+		/// or an empty view if it started from the usual starting position.
+		/// </summary>
+		std::string_view startFen;
+
+		GameResult result;
+		std::uint32_t plyCount;
+
+		/// <summary>
+		/// The packed moves of the game, two bytes each.
+		/// </summary>
+		unsigned char const* pMoves;
+
+		/// <summary>
+		/// Gets a move of the game in constant time.
+		/// </summary>
+		/// <param name="ply">The number of moves made before the move, which must be less than plyCount</param>
+		/// <returns>The move</returns>
+		Move getMove(std::uint32_t ply) const
+		{
+			std::uint16_t data;
+			std::memcpy(&data, pMoves + std::size_t(ply) * sizeof(data), sizeof(data));
+			return Move(data);
+		}
+	};
+
+	/// <summary>
+	/// Writes games to a game record file. Each game is stored as a small header, its
+	/// starting position if it is not the usual one, and its moves at two bytes each.
+	/// An index of where each game starts is written at the end so that readers can jump
+	/// straight to any game.
+	/// </summary>
+	class EXPORT GameRecordWriter
+	{
+	public:
+		/// <summary>
+		/// Creates a game record file, replacing any existing file.
+		/// </summary>
+		/// <param name="path">The path of the file to create</param>
+		/// <exception cref="std::runtime_error">Thrown if the file cannot be created</exception>
+		explicit GameRecordWriter(std::string const& path);
+
+		/// <summary>
+		/// Finishes the file if finish has not been called. Errors are ignored here,
+		/// so call finish to find out if the file was written.
+		/// </summary>
+		virtual ~GameRecordWriter();
+
+		GameRecordWriter(GameRecordWriter const&) = delete;
+		GameRecordWriter& operator=(GameRecordWriter const&) = delete;
+
+		/// <summary>
+		/// Adds a game to the end of the file. The moves are not checked, so they
+		/// should be legal moves as produced by the move generator.
+		/// </summary>
+		/// <param name="startFen">The starting position in Forsyth-Edwards Notation, or empty for the usual starting position</param>
+		/// <param name="moves">The moves of the game in the order they were played</param>
+		/// <param name="result">How the game ended</param>
+		/// <exception cref="std::invalid_argument">Thrown if the FEN is longer than any valid FEN</exception>
+		void addGame(std::string_view startFen, std::vector<Move> const& moves, GameResult result);
+
+		/// <summary>
+		/// Writes the index and header and closes the file. No games can be added afterwards.
+		/// </summary>
+		/// <exception cref="std::runtime_error">Thrown if the file could not be written</exception>
+		void finish();
+
+	private:
+		struct Impl;
+		std::unique_ptr<Impl> m_pImpl;
+	};
+
+	/// <summary>
+	/// Reads a game record file written by GameRecordWriter. The file is memory mapped and
+	/// any game and move can be reached in constant time without decoding the games before it.
+	/// </summary>
+	class EXPORT GameRecordReader
+	{
+	public:
+		/// <summary>
+		/// Maps a game record file.
+		/// </summary>
+		/// <param name="path">The path of the file</param>
+		/// <exception cref="std::runtime_error">Thrown if the file cannot be mapped or is not a game record file</exception>
+		explicit GameRecordReader(std::string const& path);
+
+		virtual ~GameRecordReader();
+
+		/// <summary>
+		/// Gets the number of games in the file.
+		/// </summary>
+		/// <returns>The number of games</returns>
+		std::size_t getGameCount() const;
+
+		/// <summary>
+		/// Gets a game in constant time.
+		/// </summary>
+		/// <param name="index">The index of the game, starting at 0</param>
+		/// <returns>A view of the game</returns>
+		/// <exception cref="std::out_of_range">Thrown if there is no game with the index</exception>
+		/// <exception cref="std::runtime_error">Thrown if the game runs past the end of the file</exception>
+		RecordedGame getGame(std::size_t index) const;
+
+		/// <summary>
+		/// Sets up a board with the position after a number of moves of a game. Only the
+		/// moves of that game are made, and they are made without checking if they are legal.
+		/// </summary>
+		/// <param name="index">The index of the game, starting at 0</param>
+		/// <param name="ply">How many moves of the game to make, which is clamped to the length of the game</param>
+		/// <param name="board">Receives the position</param>
+		/// <exception cref="std::out_of_range">Thrown if there is no game with the index</exception>
+		/// <exception cref="std::runtime_error">Thrown if the game is corrupt</exception>
+		void getPosition(std::size_t index, std::uint32_t ply, Board& board) const;
+
+	private:
+		struct Impl;
+		std::unique_ptr<Impl> m_pImpl;
+	};
+}
+}
@@ -0,0 +1,54 @@
+// Author:	Liam Scholte
+// Created:	10/17/2026 6:12:47 PM
+// This file contains the class definition for MemoryMappedFile
+
+#pragma once
+
+#include <Chess/Macros.h>
+
+#include <cstddef>
+#include <memory>
+#include <string>
+
+namespace Chess
+{
+namespace Model
+{
+	/// <summary>
+	/// A read-only view of a whole file mapped into memory. Pages are loaded
+	/// on demand by the operating system and shared between processes mapping
+	/// the same file, so large data files cost nothing until they are read.
+	/// </summary>
+	class EXPORT MemoryMappedFile
+	{
+	public:
+		/// <summary>
+		/// Maps a file into memory.
+		/// </summary>
+		/// <param name="path">The path of the file to map</param>
+		/// <exception cref="std::runtime_error">Thrown if the file cannot be opened or mapped</exception>
+		explicit MemoryMappedFile(std::string const& path);
+
+		virtual ~MemoryMappedFile();
+
+		MemoryMappedFile(MemoryMappedFile const&) = delete;
+		MemoryMappedFile& operator=(MemoryMappedFile const&) = delete;
+
+		/// <summary>
+		/// Gets the contents of the file. The pointer is aligned to a page boundary.
+		/// </summary>
+		/// <returns>The first byte of the file, or nullptr if the file is empty</returns>
+		unsigned char const* getData() const;
+
+		/// <summary>
+		/// Gets the size of the file.
+		/// </summary>
+		/// <returns>The size of the file in bytes</returns>
+		std::size_t getSize() const;
+
+	private:
+		struct Impl;
+		std::unique_ptr<Impl> m_pImpl;
+	};
+}
+}
@@ -0,0 +1,200 @@
+// Author:	Liam Scholte
+// Created:	10/17/2026 10:31:40 AM
+// This file contains the class definitions for Move and UndoRecord
+
+#pragma once
+
+#include <Chess/Macros.h>
+#include <Chess/Model/FwdDecl.h>
+#include <Chess/Model/Bitboard.h>
+#include <Chess/Model/PieceCode.h>
+
+#include <cstdint>
+
+namespace Chess
+{
+namespace Model
+{
+	/// <summary>
+	/// The kind of a move, stored in the upper 4 bits of a Move.
+	/// Bit 2 marks a capture and bit 3 marks a promotion, in which case
+	/// the lower 2 bits select the promotion piece.
+	/// </summary>
+	enum class MoveFlag : std::uint8_t
+	{
+		Quiet = 0,
+		DoublePawnPush = 1,
+		KingCastle = 2,
+		QueenCastle = 3,
+		Capture = 4,
+		EnPassantCapture = 5,
+		KnightPromotion = 8,
+		BishopPromotion = 9,
+		RookPromotion = 10,
+		QueenPromotion = 11,
+		KnightPromotionCapture = 12,
+		BishopPromotionCapture = 13,
+		RookPromotionCapture = 14,
+		QueenPromotionCapture = 15
+	};
+
+	/// <summary>
+	/// Represents the movement of a piece from one square to another, packed into 16 bits.
+	/// Bits 0-5 hold the origin square, bits 6-11 the destination square and bits 12-15 the MoveFlag.
+	/// </summary>
+	class EXPORT Move
+	{
+	public:
+		/// <summary>
+		/// Constructs a null move that does not move any piece.
+		/// </summary>
+		Move();
+
+		/// <summary>
+		/// Constructs a move between two squares.
+		/// </summary>
+		/// <param name="from">The square of the piece to move</param>
+		/// <param name="to">The square to move the piece to</param>
+		/// <param name="flag">The kind of move</param>
+		Move(Square from, Square to, MoveFlag flag);
+
+		/// <summary>
+		/// Constructs a move between two positions without any knowledge of the board.
+		/// A pawn moved to the last rank by such a move is promoted to a queen.
+		/// </summary>
+		/// <param name="from">The position of the piece to move</param>
+		/// <param name="to">The position to move the piece to</param>
+		Move(Position from, Position to);
+
+		/// <summary>
+		/// Constructs a pawn move to the last rank that promotes to a particular type of piece.
+		/// </summary>
+		/// <param name="from">The position of the pawn to move</param>
+		/// <param name="to">The position to move the pawn to</param>
+		/// <param name="promotion">The type of piece to promote to, which must be a knight, bishop, rook or queen</param>
+		Move(Position from, Position to, PieceType promotion);
+
+		/// <summary>
+		/// Constructs a move from the 16 bits returned by getData.
+		/// </summary>
+		/// <param name="data">The packed move</param>
+		explicit Move(std::uint16_t data);
+
+		/// <summary>
+		/// Gets the 16 bits this move is packed into, for storing it compactly.
+		/// </summary>
+		/// <returns>The packed move</returns>
+		std::uint16_t getData() const;
+
+		Square getFrom() const;
+		Square getTo() const;
+		MoveFlag getFlag() const;
+
+		/// <summary>
+		/// Determines if this move captures a piece. Only moves produced by the move generator
+		/// are flagged as captures, since a move constructed from positions knows nothing about the board.
+		/// </summary>
+		/// <returns>True if this move is flagged as a capture, false otherwise</returns>
+		bool isCapture() const;
+
+		/// <summary>
+		/// Determines if this move explicitly chooses a promotion piece.
+		/// </summary>
+		/// <returns>True if this move is a promotion, false otherwise</returns>
+		bool isPromotion() const;
+
+		/// <summary>
+		/// Gets the type of piece a pawn becomes if this move takes it to the last rank.
+		/// Moves that are not flagged as promotions promote to a queen.
+		/// </summary>
+		/// <returns>The promotion type</returns>
+		PieceType getPromotion() const;
+
+		bool operator==(Move other) const;
+		bool operator!=(Move other) const;
+
+	private:
+		std::uint16_t m_data;
+	};
+
+	/// <summary>
+	/// The information needed to take back a move made with Board::makeMove.
+	/// </summary>
+	struct EXPORT UndoRecord
+	{
+		/// <summary>
+		/// The piece that moved, which for a promotion is the pawn rather than the piece it became.
+		/// </summary>
+		PieceCode movedPiece;
+
+		/// <summary>
+		/// The piece that was captured by the move, or an empty code if there was none, and the square it was on.
+		/// A pawn captured en passant was not on the square moved to.
+		/// </summary>
+		PieceCode capturedPiece;
+		Square capturedSquare;
+
+		/// <summary>
+		/// The castling rights, en passant target, halfmove clock and hash of the board before the move.
+		/// </summary>
+		unsigned char castlingRights;
+		Square enPassantSquare;
+		unsigned int halfmoveClock;
+		std::uint64_t hash;
+	};
+
+	//The accessors are used in the innermost loops of move generation and search,
+	//so they are defined here where they can be inlined
+	inline Move::Move()
+		: m_data(0)
+	{}
+
+	inline Move::Move(Square from, Square to, MoveFlag flag)
+		: m_data(static_cast<std::uint16_t>(from | (to << 6) | (static_cast<unsigned int>(flag) << 12)))
+	{}
+
+	inline Move::Move(std::uint16_t data)
+		: m_data(data)
+	{}
+
+	inline std::uint16_t Move::getData() const
+	{
+		return m_data;
+	}
+
+	inline Square Move::getFrom() const
+	{
+		return static_cast<Square>(m_data & 0x3F);
+	}
+
+	inline Square Move::getTo() const
+	{
+		return static_cast<Square>((m_data >> 6) & 0x3F);
+	}
+
+	inline MoveFlag Move::getFlag() const
+	{
+		return static_cast<MoveFlag>(m_data >> 12);
+	}
+
+	inline bool Move::isCapture() const
+	{
+		return (m_data & 0x4000) != 0;
+	}
+
+	inline bool Move::isPromotion() const
+	{
+		return (m_data & 0x8000) != 0;
+	}
+
+	inline bool Move::operator==(Move other) const
+	{
+		return m_data == other.m_data;
+	}
+
+	inline bool Move::operator!=(Move other) const
+	{
+		return m_data != other.m_data;
+	}
+}
+}
@@ -0,0 +1,120 @@
+// Author:	Liam Scholte
+// Created:	10/17/2026 2:48:26 PM
+// This file contains the class definition for MoveList
+
+#pragma once
+
+#include <Chess/Model/Move.h>
+
+#include <array>
+#include <cassert>
+#include <cstddef>
+#include <utility>
+
+namespace Chess
+{
+namespace Model
+{
+	/// <summary>
+	/// A list of moves with a fixed capacity that lives entirely on the stack.
+	/// No legal chess position has more than 218 moves, so MAX_MOVES is never exceeded
+	/// and adding a move never allocates memory. Board only accepts positions that can arise
+	/// in a game, which is what keeps generated moves within the capacity.
+	/// </summary>
+	class MoveList
+	{
+	public:
+		static std::size_t constexpr MAX_MOVES = 256;
+
+		MoveList()
+			: m_size(0)
+		{}
+
+		/// <summary>
+		/// Adds a move to the end of the list. The list must hold fewer than MAX_MOVES moves.
+		/// </summary>
+		/// <param name="move">The move to add</param>
+		void push_back(Move move)
+		{
+			assert(m_size < MAX_MOVES);
+			m_moves[m_size++] = move;
+		}
+
+		/// <summary>
+		/// Constructs a move at the end of the list. The list must hold fewer than MAX_MOVES moves.
+		/// </summary>
+		template <typename... Args>
+		void emplace_back(Args&&... args)
+		{
+			assert(m_size < MAX_MOVES);
+			m_moves[m_size++] = Move(std::forward<Args>(args)...);
+		}
+
+		void clear()
+		{
+			m_size = 0;
+		}
+
+		std::size_t size() const
+		{
+			return m_size;
+		}
+
+		bool empty() const
+		{
+			return m_size == 0;
+		}
+
+		/// <summary>
+		/// Determines if the list contains a move.
+		/// </summary>
+		/// <param name="move">The move to search for</param>
+		/// <returns>True if the move is in the list, false otherwise</returns>
+		bool contains(Move move) const
+		{
+			for (Move listMove : *this)
+			{
+				if (listMove == move)
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+
+		Move& operator[](std::size_t index)
+		{
+			return m_moves[index];
+		}
+
+		Move operator[](std::size_t index) const
+		{
+			return m_moves[index];
+		}
+
+		Move* begin()
+		{
+			return m_moves.data();
+		}
+
+		Move* end()
+		{
+			return m_moves.data() + m_size;
+		}
+
+		Move const* begin() const
+		{
+			return m_moves.data();
+		}
+
+		Move const* end() const
+		{
+			return m_moves.data() + m_size;
+		}
+
+	private:
+		std::array<Move, MAX_MOVES> m_moves;
+		std::size_t m_size;
+	};
+}
+}
@@ -0,0 +1,121 @@
+// Author:	Liam Scholte
+// Created:	10/17/2026 6:40:31 PM
+// This file contains the class definition for NeuralNetwork
+
+#pragma once
+
+#include <Chess/Macros.h>
+#include <Chess/Model/Bitboard.h>
+#include <Chess/Model/FwdDecl.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace Chess
+{
+namespace Model
+{
+	/// <summary>
+	/// An efficiently updatable neural network that evaluates positions.
+	/// The input layer has one feature per combination of piece color, type and square, seen from each
+	/// side's perspective, and feeds a hidden layer whose values (the accumulator) are updated incrementally
+	/// by adding or subtracting a column of weights whenever a piece is added, removed or moved.
+	/// The two perspectives of the hidden layer pass through a clipped ReLU into a single output.
+	///
+	/// Weights are quantized to 16-bit integers and read straight out of a memory-mapped network file.
+	/// The kernels that update and read the accumulator use AVX2, SSE2 or NEON, whichever is the
+	/// best the processor supports, falling back to plain C++ otherwise.
+	///
+	/// The network file is little endian and consists of a 64 byte header, holding the magic "ARCN",
+	/// the format version, FEATURE_COUNT and HIDDEN_SIZE as 32-bit integers followed by zeroes, and then
+	/// the 16-bit input weights (FEATURE_COUNT columns of HIDDEN_SIZE), the HIDDEN_SIZE hidden biases,
+	/// the 2 * HIDDEN_SIZE output weights (side to move first) and the output bias.
+	/// </summary>
+	class EXPORT NeuralNetwork
+	{
+	public:
+		static int constexpr FEATURE_COUNT = 2 * 6 * SQUARE_COUNT;
+		static int constexpr HIDDEN_SIZE = 256;
+
+		/// <summary>
+		/// The hidden layer values of a position from white's (index 0) and black's (index 1) perspective.
+		/// </summary>
+		struct alignas(64) Accumulator
+		{
+			std::int16_t values[2][HIDDEN_SIZE];
+		};
+
+		/// <summary>
+		/// Loads a network from a file.
+		/// </summary>
+		/// <param name="path">The path of the network file</param>
+		/// <exception cref="std::runtime_error">Thrown if the file cannot be mapped or is not a valid network</exception>
+		explicit NeuralNetwork(std::string const& path);
+
+		/// <summary>
+		/// Loads a network from a file that uses the kernels of a particular instruction set rather than
+		/// the best one the processor supports, so that the kernels can be checked against each other.
+		/// </summary>
+		/// <param name="path">The path of the network file</param>
+		/// <param name="instructionSet">One of the names returned by getSupportedInstructionSets</param>
+		/// <exception cref="std::runtime_error">Thrown if the file cannot be mapped or is not a valid network</exception>
+		/// <exception cref="std::invalid_argument">Thrown if the processor does not support the instruction set</exception>
+		NeuralNetwork(std::string const& path, std::string_view instructionSet);
+
+		virtual ~NeuralNetwork();
+
+		NeuralNetwork(NeuralNetwork const&) = delete;
+		NeuralNetwork& operator=(NeuralNetwork const&) = delete;
+
+		/// <summary>
+		/// Resets an accumulator to that of an empty board.
+		/// </summary>
+		/// <param name="accumulator">The accumulator to reset</param>
+		void reset(Accumulator& accumulator) const;
+
+		/// <summary>
+		/// Updates an accumulator for a piece being added to the board.
+		/// </summary>
+		void addPiece(Accumulator& accumulator, bool isWhite, PieceType type, Square square) const;
+
+		/// <summary>
+		/// Updates an accumulator for a piece being removed from the board.
+		/// </summary>
+		void removePiece(Accumulator& accumulator, bool isWhite, PieceType type, Square square) const;
+
+		/// <summary>
+		/// Updates an accumulator for a piece moving from one square to another.
+		/// </summary>
+		void movePiece(Accumulator& accumulator, bool isWhite, PieceType type, Square from, Square to) const;
+
+		/// <summary>
+		/// Evaluates a position from its accumulator.
+		/// </summary>
+		/// <param name="accumulator">The accumulator of the position</param>
+		/// <param name="isWhiteMove">Whether white or black is to move</param>
+		/// <returns>The score in centipawns from the side to move's point of view, kept strictly
+		/// within MATE_THRESHOLD so that it is never mistaken for a mate score</returns>
+		int evaluate(Accumulator const& accumulator, bool isWhiteMove) const;
+
+		/// <summary>
+		/// Gets the name of the instruction set the kernels were selected for on this processor.
+		/// </summary>
+		/// <returns>"AVX2", "SSE2", "NEON" or "Scalar"</returns>
+		static char const* getInstructionSet();
+
+		/// <summary>
+		/// Gets the names of every instruction set this processor has kernels for, best first.
+		/// "Scalar" is always last.
+		/// </summary>
+		/// <returns>The names of the supported instruction sets</returns>
+		static std::vector<char const*> getSupportedInstructionSets();
+
+	private:
+		struct Impl;
+		std::unique_ptr<Impl> m_pImpl;
+	};
+}
+}
@@ -0,0 +1,27 @@
+// Author:	Liam Scholte
+// Created:	10/17/2026 8:04:37 PM
+// This file contains functions for reading moves written in Standard Algebraic Notation
+
+#pragma once
+
+#include <Chess/Macros.h>
+#include <Chess/Model/FwdDecl.h>
+#include <Chess/Model/Move.h>
+
+#include <string_view>
+
+namespace Chess
+{
+namespace Model
+{
+	/// <summary>
+	/// Finds the legal move that a move in Standard Algebraic Notation (SAN) describes, such as
+	/// "e4", "Nbd7", "exd6", "R1a3", "e8=Q+" or "O-O". Check and annotation suffixes are ignored,
+	/// and castling may also be written with zeros.
+	/// </summary>
+	/// <param name="board">The position the move is played in</param>
+	/// <param name="san">The move in Standard Algebraic Notation</param>
+	/// <returns>The legal move, or a null move if the SAN is malformed, ambiguous or describes no legal move</returns>
+	EXPORT Move parseSan(Board const& board, std::string_view san);
+}
+}
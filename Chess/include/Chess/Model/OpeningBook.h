@@ -0,0 +1,123 @@
+// Author:	Liam Scholte
+// Created:	10/17/2026 9:37:18 PM
+// This file contains the class definitions for OpeningBook and OpeningBookWriter
+
+#pragma once
+
+#include <Chess/Macros.h>
+#include <Chess/Model/FwdDecl.h>
+#include <Chess/Model/Move.h>
+
+#include <cstdint>
+#include <memory>
+#include <string>
+#include <vector>
+
+namespace Chess
+{
+namespace Model
+{
+	/// <summary>
+	/// A move suggested by an opening book for a position.
+	/// </summary>
+	struct EXPORT BookMove
+	{
+		Move move;
+
+		/// <summary>
+		/// How often the move should be chosen relative to the other moves for the position.
+		/// </summary>
+		std::uint16_t weight;
+	};
+
+	/// <summary>
+	/// Computes the key of a position in a Polyglot opening book. It is a Zobrist hash like
+	/// Board::getHash, but built from the fixed random numbers that every Polyglot book uses.
+	/// </summary>
+	/// <param name="board">The position</param>
+	/// <returns>The Polyglot key of the position</returns>
+	EXPORT std::uint64_t polyglotKey(Board const& board);
+
+	/// <summary>
+	/// An opening book in the Polyglot file layout: a file of 16-byte big-endian entries
+	/// (key, move, weight, learn) sorted by key. The file is memory mapped and looked up
+	/// with a binary search, so probing it costs a handful of page reads and no parsing.
+	///
+	/// Entries are keyed by polyglotKey, so third party Polyglot books can be read and books
+	/// written by OpeningBookWriter can be read by other Polyglot programs. Moves are encoded
+	/// the Polyglot way, with castling written as the king taking its own rook.
+	/// </summary>
+	class EXPORT OpeningBook
+	{
+	public:
+		/// <summary>
+		/// Maps an opening book file.
+		/// </summary>
+		/// <param name="path">The path of the book</param>
+		/// <exception cref="std::runtime_error">Thrown if the file cannot be mapped or is not a whole number of entries</exception>
+		explicit OpeningBook(std::string const& path);
+
+		virtual ~OpeningBook();
+
+		/// <summary>
+		/// Gets the number of entries in the book.
+		/// </summary>
+		/// <returns>The number of entries</returns>
+		std::size_t getEntryCount() const;
+
+		/// <summary>
+		/// Finds the book moves for a position. Entries that are not legal in the
+		/// position, which can only come from a hash collision, are left out.
+		/// </summary>
+		/// <param name="board">The position to look up</param>
+		/// <returns>The legal book moves in the order they appear in the book</returns>
+		std::vector<BookMove> findMoves(Board const& board) const;
+
+		/// <summary>
+		/// Chooses one of the book moves for a position at random, in proportion to their weights.
+		/// </summary>
+		/// <param name="board">The position to look up</param>
+		/// <param name="random">A random number, which makes the choice</param>
+		/// <returns>The chosen move, or a null move if the book has no moves with any weight for the position</returns>
+		Move chooseMove(Board const& board, std::uint32_t random) const;
+
+	private:
+		struct Impl;
+		std::unique_ptr<Impl> m_pImpl;
+	};
+
+	/// <summary>
+	/// Builds an opening book by counting how often each move was played in each position.
+	/// </summary>
+	class EXPORT OpeningBookWriter
+	{
+	public:
+		/// <summary>
+		/// Constructs a writer for an empty book.
+		/// </summary>
+		OpeningBookWriter();
+
+		virtual ~OpeningBookWriter();
+
+		/// <summary>
+		/// Counts a move played in a position.
+		/// </summary>
+		/// <param name="key">The key of the position, from polyglotKey</param>
+		/// <param name="move">The move played, as produced by the move generator</param>
+		void addMove(std::uint64_t key, Move move);
+
+		/// <summary>
+		/// Writes the book sorted by key, and the moves of each position from the heaviest to the lightest
+		/// as Polyglot does. Each move is weighted by how often it was played, capped at the largest weight the file can hold.
+		/// </summary>
+		/// <param name="path">The path of the book to create, replacing any existing file</param>
+		/// <param name="minimumCount">How often a move must have been played to be written</param>
+		/// <exception cref="std::runtime_error">Thrown if the file could not be written</exception>
+		void write(std::string const& path, std::uint32_t minimumCount = 1) const;
+
+	private:
+		struct Impl;
+		std::unique_ptr<Impl> m_pImpl;
+	};
+}
+}
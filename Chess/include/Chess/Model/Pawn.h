@@ -6,8 +6,6 @@
 
 #include <Chess/Model/Piece.h>
 
-#include <memory>
-
 namespace Chess
 {
 namespace Model
@@ -38,14 +36,7 @@ namespace Model
 
 		virtual PieceType getType() const override;
 
-		virtual std::vector<Position> getAttackingPositions(Board const& board) const override;
-
-		virtual bool move(Board& board, Position newPosition) override;
-
-	private:
-		struct Impl;
-		std::unique_ptr<Impl> m_pImpl;
-
+		virtual Bitboard getAttackingSquares(Board const& board) const override;
 	};
 }
 }
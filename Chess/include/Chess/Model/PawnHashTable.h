@@ -0,0 +1,57 @@
+// Author:	Liam Scholte
+// Created:	10/17/2026 7:25:58 PM
+// This file contains the class definition for PawnHashTable
+
+#pragma once
+
+#include <Chess/Macros.h>
+#include <Chess/Model/Bitboard.h>
+#include <Chess/Model/Evaluation.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace Chess
+{
+namespace Model
+{
+	/// <summary>
+	/// A small hash table of pawn structure evaluations keyed by the pawn-only Zobrist hash of a position.
+	/// Pawns move far less often than other pieces, so nearly every node of a search finds its
+	/// pawn structure already evaluated. The table is not thread safe and is meant to be owned by one thread.
+	/// </summary>
+	class EXPORT PawnHashTable
+	{
+	public:
+		/// <summary>
+		/// Constructs an empty pawn hash table.
+		/// </summary>
+		/// <param name="sizeInKilobytes">The memory to use, which is rounded down to a power of two number of entries</param>
+		explicit PawnHashTable(std::size_t sizeInKilobytes = 256);
+
+		virtual ~PawnHashTable();
+
+		PawnHashTable(PawnHashTable const&) = delete;
+		PawnHashTable& operator=(PawnHashTable const&) = delete;
+
+		/// <summary>
+		/// Discards all entries.
+		/// </summary>
+		void clear();
+
+		/// <summary>
+		/// Gets the evaluation of a pawn structure, evaluating and storing it if it is not in the table.
+		/// </summary>
+		/// <param name="pawnHash">The pawn-only Zobrist hash of the position</param>
+		/// <param name="whitePawns">The squares of the white pawns</param>
+		/// <param name="blackPawns">The squares of the black pawns</param>
+		/// <returns>The evaluation of the pawn structure, which is valid until the next probe</returns>
+		PawnEvaluation const& probe(std::uint64_t pawnHash, Bitboard whitePawns, Bitboard blackPawns);
+
+	private:
+		struct Impl;
+		std::unique_ptr<Impl> m_pImpl;
+	};
+}
+}
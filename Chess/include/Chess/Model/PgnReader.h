@@ -0,0 +1,85 @@
+// Author:	Liam Scholte
+// Created:	10/17/2026 8:21:12 PM
+// This file contains the class definitions for PgnGame and PgnReader
+
+#pragma once
+
+#include <Chess/Macros.h>
+
+#include <cstddef>
+#include <string_view>
+#include <vector>
+
+namespace Chess
+{
+namespace Model
+{
+	/// <summary>
+	/// A game in Portable Game Notation (PGN). The game views the text it was read from
+	/// rather than copying it, so the text must outlive the game.
+	/// </summary>
+	struct EXPORT PgnGame
+	{
+		/// <summary>
+		/// The tag pair section, one [Name "Value"] pair per line.
+		/// </summary>
+		std::string_view tags;
+
+		/// <summary>
+		/// The moves, comments, variations and result that follow the tag pairs.
+		/// </summary>
+		std::string_view movetext;
+
+		/// <summary>
+		/// Gets the value of a tag pair, such as the FEN tag of a game that does not start from the usual position.
+		/// </summary>
+		/// <param name="name">The name of the tag</param>
+		/// <returns>The value without its quotes, or an empty view if the game has no such tag</returns>
+		std::string_view getTag(std::string_view name) const;
+
+		/// <summary>
+		/// Reads the next move of the main line from the movetext. Move numbers, comments,
+		/// variations, numeric annotation glyphs and the result are skipped.
+		/// </summary>
+		/// <param name="offset">Where to start reading in the movetext, which is advanced past the move</param>
+		/// <param name="san">Receives the move in Standard Algebraic Notation</param>
+		/// <returns>True if a move was read, false if the movetext has no more moves</returns>
+		bool readSan(std::size_t& offset, std::string_view& san) const;
+	};
+
+	/// <summary>
+	/// Reads the games in a Portable Game Notation (PGN) file one at a time without copying them.
+	/// Each game is a block of tag pair lines followed by movetext, so a game starts at the first
+	/// line beginning with '[' after the movetext of the previous game.
+	/// </summary>
+	class EXPORT PgnReader
+	{
+	public:
+		/// <summary>
+		/// Constructs a reader over the text of a PGN file, such as a memory mapped file.
+		/// </summary>
+		/// <param name="text">The text to read games from, which must outlive the reader and its games</param>
+		explicit PgnReader(std::string_view text);
+
+		/// <summary>
+		/// Reads the next game.
+		/// </summary>
+		/// <param name="game">Receives the game</param>
+		/// <returns>True if a game was read, false if there are no more games</returns>
+		bool readGame(PgnGame& game);
+
+		/// <summary>
+		/// Splits the text of a PGN file into roughly equal chunks that each hold whole games,
+		/// so that the chunks can be read by separate readers in parallel.
+		/// </summary>
+		/// <param name="text">The text of the PGN file</param>
+		/// <param name="chunkCount">How many chunks to aim for. Fewer are returned if there are not enough games</param>
+		/// <returns>The chunks in the order they appear in the text</returns>
+		static std::vector<std::string_view> splitIntoChunks(std::string_view text, std::size_t chunkCount);
+
+	private:
+		std::string_view m_text;
+		std::size_t m_offset;
+	};
+}
+}
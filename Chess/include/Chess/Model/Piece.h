@@ -6,24 +6,21 @@
 
 #include <Chess/Macros.h>
 #include <Chess/Model/FwdDecl.h>
+#include <Chess/Model/Bitboard.h>
+#include <Chess/Model/MoveList.h>
+#include <Chess/Model/PieceCode.h>
+#include <Chess/Model/Position.h>
 
-#include <vector>
 #include <memory>
 
 namespace Chess
 {
 namespace Model
 {
-	/// <summary>
-	/// Represents possible types of chess pieces.
-	/// </summary>
-	enum class PieceType
-	{
-		Pawn, Rook, Knight, Bishop, Queen, King
-	};
-
 	/// <summary>
 	/// An abstract chess piece that can be placed on a board.
+	/// A board stores its pieces by value as PieceCodes, and a Piece is a view of one of them
+	/// at the position it had when the view was created, which does not follow later moves.
 	/// </summary>
 	class EXPORT Piece : public std::enable_shared_from_this<Piece>
 	{
@@ -68,29 +65,30 @@ namespace Model
 		virtual Position getPosition() const;
 
 		/// <summary>
-		/// Moves this piece to a new position on the board.
+		/// Moves this piece to a new position on the board and passes the turn to the other color.
+		/// A king moved two squares castles, and a pawn that reaches the last rank is promoted.
 		/// Does nothing if the move would be illegal.
 		/// </summary>
 		/// <param name="board">The board containing all other pieces</param>
 		/// <param name="newPosition">The position to move to</param>
+		/// <param name="promotion">The piece a pawn reaching the last rank is promoted to</param>
 		/// <returns>True if the move was completed, false otherwise</returns>
-		virtual bool move(Board& board, Position newPosition);
+		virtual bool move(Board& board, Position newPosition, PieceType promotion = PieceType::Queen);
 
 		/// <summary>
-		/// Gets the positions that this piece threatens.
-		/// A position that is under attack is not necessarily a legal move.
+		/// Gets the squares that this piece threatens.
+		/// A square that is under attack is not necessarily a legal move.
 		/// </summary>
 		/// <param name="board">The board containing all other pieces</param>
-		/// <returns>A vector of positions that this piece threatens in no particular order</returns>
-		virtual std::vector<Position> getAttackingPositions(Board const& board) const = 0;
+		/// <returns>A bitboard of the squares that this piece threatens</returns>
+		virtual Bitboard getAttackingSquares(Board const& board) const = 0;
 
 		/// <summary>
-		/// Gets the positions that a piece may legally move to.
-		/// A legal position will not include the current position.
+		/// Gets the moves that this piece may legally make.
 		/// </summary>
 		/// <param name="board">The board containing all other pieces</param>
-		/// <returns>A vector of legal positions this piece can move to in no particular order</returns>
-		virtual std::vector<Position> getLegalMoves(Board const& board) const;
+		/// <returns>The legal moves of this piece in no particular order</returns>
+		virtual MoveList getLegalMoves(Board const& board) const;
 
 		/// <summary>
 		/// Determines if there are any opposing pieces on the board
@@ -101,8 +99,8 @@ namespace Model
 		virtual bool isUnderAttack(Board const& board) const;
 
 	private:
-		struct Impl;
-		std::unique_ptr<Impl> m_pImpl;
+		bool m_isWhite;
+		Position m_position;
 	};
 }
 }
@@ -0,0 +1,99 @@
+// Author:	Liam Scholte
+// Created:	10/17/2026 11:24:16 PM
+// This file contains the definitions for PieceType and PieceCode
+
+#pragma once
+
+namespace Chess
+{
+namespace Model
+{
+	/// <summary>
+	/// Represents possible types of chess pieces.
+	/// </summary>
+	enum class PieceType
+	{
+		Pawn, Rook, Knight, Bishop, Queen, King
+	};
+
+	/// <summary>
+	/// A piece stored by value as its color and type packed into a single byte, so that a board
+	/// can keep the piece on every square in one small contiguous array and be copied without allocating.
+	/// Bits 0-2 hold the PieceType plus one, which leaves 0 for an empty square, and bit 3 is set for black.
+	/// </summary>
+	class PieceCode
+	{
+	public:
+		/// <summary>
+		/// Constructs the code of an empty square.
+		/// </summary>
+		PieceCode();
+
+		/// <summary>
+		/// Constructs the code of a piece.
+		/// </summary>
+		/// <param name="isWhite">Whether the piece is white or black</param>
+		/// <param name="type">The type of the piece</param>
+		PieceCode(bool isWhite, PieceType type);
+
+		/// <summary>
+		/// Determines if this is the code of an empty square rather than of a piece.
+		/// </summary>
+		/// <returns>True if there is no piece, false otherwise</returns>
+		bool isEmpty() const;
+
+		/// <summary>
+		/// Determines if the piece is white or black. Only meaningful if the code is not empty.
+		/// </summary>
+		/// <returns>True if the piece is white, false if black</returns>
+		bool isWhite() const;
+
+		/// <summary>
+		/// Gets the type of the piece. Only meaningful if the code is not empty.
+		/// </summary>
+		/// <returns>The type of the piece</returns>
+		PieceType getType() const;
+
+		bool operator==(PieceCode other) const;
+		bool operator!=(PieceCode other) const;
+
+	private:
+		unsigned char m_data;
+	};
+
+	//The accessors are used whenever a move is made or generated,
+	//so they are defined here where they can be inlined
+	inline PieceCode::PieceCode()
+		: m_data(0)
+	{}
+
+	inline PieceCode::PieceCode(bool isWhite, PieceType type)
+		: m_data(static_cast<unsigned char>((static_cast<unsigned int>(type) + 1) | (isWhite ? 0 : 8)))
+	{}
+
+	inline bool PieceCode::isEmpty() const
+	{
+		return m_data == 0;
+	}
+
+	inline bool PieceCode::isWhite() const
+	{
+		return (m_data & 8) == 0;
+	}
+
+	inline PieceType PieceCode::getType() const
+	{
+		return static_cast<PieceType>((m_data & 7) - 1);
+	}
+
+	inline bool PieceCode::operator==(PieceCode other) const
+	{
+		return m_data == other.m_data;
+	}
+
+	inline bool PieceCode::operator!=(PieceCode other) const
+	{
+		return m_data != other.m_data;
+	}
+}
+}
@@ -0,0 +1,123 @@
+// Author:	Liam Scholte
+// Created:	10/17/2026 11:08:41 PM
+// This file contains the class definition for PositionHistory
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace Chess
+{
+namespace Model
+{
+	/// <summary>
+	/// The positions reached in a game, oldest first, kept as their Zobrist hashes and halfmove clocks.
+	/// Only positions since the last capture or pawn move can repeat, so checking for a repetition
+	/// scans back over at most that many hashes, and only those with the same side to move.
+	/// </summary>
+	class PositionHistory
+	{
+	public:
+		/// <summary>
+		/// The halfmove clock at which either player can claim a draw under the fifty-move rule.
+		/// </summary>
+		static unsigned int constexpr FIFTY_MOVE_PLIES = 100;
+
+		void push(std::uint64_t hash, unsigned int halfmoveClock)
+		{
+			m_hashes.push_back(hash);
+			m_halfmoveClocks.push_back(halfmoveClock);
+		}
+
+		void pop()
+		{
+			m_hashes.pop_back();
+			m_halfmoveClocks.pop_back();
+		}
+
+		void clear()
+		{
+			m_hashes.clear();
+			m_halfmoveClocks.clear();
+		}
+
+		std::size_t size() const
+		{
+			return m_hashes.size();
+		}
+
+		bool empty() const
+		{
+			return m_hashes.empty();
+		}
+
+		/// <summary>
+		/// Gets the hash of a position in the history.
+		/// </summary>
+		/// <param name="index">The index of the position, where 0 is the oldest</param>
+		/// <returns>The hash of the position</returns>
+		std::uint64_t getHash(std::size_t index) const
+		{
+			return m_hashes[index];
+		}
+
+		/// <summary>
+		/// Gets the halfmove clock of the latest position.
+		/// </summary>
+		/// <returns>The number of plies since the last capture or pawn move</returns>
+		unsigned int getHalfmoveClock() const
+		{
+			return m_halfmoveClocks.back();
+		}
+
+		/// <summary>
+		/// Counts how many times the latest position occurred earlier in the history.
+		/// </summary>
+		/// <returns>The number of earlier occurrences</returns>
+		int getRepetitionCount() const
+		{
+			if (empty())
+			{
+				return 0;
+			}
+
+			std::size_t last = size() - 1;
+			std::size_t reversiblePlies = m_halfmoveClocks[last];
+			int count = 0;
+			for (std::size_t distance = 2; distance <= reversiblePlies && distance <= last; distance += 2)
+			{
+				if (m_hashes[last - distance] == m_hashes[last])
+				{
+					++count;
+				}
+			}
+			return count;
+		}
+
+		/// <summary>
+		/// Determines if the latest position has occurred three times, which makes the game a draw.
+		/// </summary>
+		/// <returns>True if the latest position has occurred three times, false otherwise</returns>
+		bool isThreefoldRepetition() const
+		{
+			return getRepetitionCount() >= 2;
+		}
+
+		/// <summary>
+		/// Determines if fifty moves have been played by each side without a capture or pawn move.
+		/// </summary>
+		/// <returns>True if the fifty-move rule applies, false otherwise</returns>
+		bool isFiftyMoveDraw() const
+		{
+			return !empty() && getHalfmoveClock() >= FIFTY_MOVE_PLIES;
+		}
+
+	private:
+		//Kept apart rather than as pairs so that scanning the hashes touches as little memory as possible
+		std::vector<std::uint64_t> m_hashes;
+		std::vector<unsigned int> m_halfmoveClocks;
+	};
+}
+}
@@ -36,7 +36,7 @@ namespace Model
 
 		virtual PieceType getType() const override;
 
-		virtual std::vector<Position> getAttackingPositions(Board const& board) const override;
+		virtual Bitboard getAttackingSquares(Board const& board) const override;
 	};
 }
 }
@@ -0,0 +1,145 @@
+// Author:	Liam Scholte
+// Created:	10/17/2026 4:41:09 PM
+// This file contains the class definitions for Search, SearchLimits and SearchResult
+
+#pragma once
+
+#include <Chess/Macros.h>
+#include <Chess/Model/FwdDecl.h>
+#include <Chess/Model/Move.h>
+
+#include <chrono>
+#include <cstdint>
+#include <memory>
+#include <vector>
+
+namespace Chess
+{
+namespace Model
+{
+	/// <summary>
+	/// The deepest a search can go, counting quiescence search.
+	/// </summary>
+	int constexpr MAX_PLY = 128;
+
+	/// <summary>
+	/// The score of checkmating on the current move. Mate in n plies scores MATE_SCORE - n.
+	/// </summary>
+	int constexpr MATE_SCORE = 32000;
+
+	/// <summary>
+	/// Scores beyond this are mates rather than evaluations.
+	/// </summary>
+	int constexpr MATE_THRESHOLD = MATE_SCORE - MAX_PLY;
+
+	/// <summary>
+	/// When a search should stop. A limit of zero means no limit.
+	/// The search always completes at least a depth 1 search so there is a move to play,
+	/// unless stop was called before it started.
+	/// </summary>
+	struct EXPORT SearchLimits
+	{
+		int depth = MAX_PLY - 1;
+		std::uint64_t nodes = 0;
+		std::chrono::milliseconds time = std::chrono::milliseconds(0);
+	};
+
+	/// <summary>
+	/// The outcome of the deepest iteration a search completed.
+	/// </summary>
+	struct EXPORT SearchResult
+	{
+		/// <summary>
+		/// The best move found, or a null move if the side to move has no legal moves.
+		/// </summary>
+		Move bestMove;
+
+		/// <summary>
+		/// The score of the position in centipawns from the side to move's point of view.
+		/// </summary>
+		int score = 0;
+
+		int depth = 0;
+		std::uint64_t nodes = 0;
+
+		/// <summary>
+		/// The sequence of moves expected to be played, starting with the best move.
+		/// </summary>
+		std::vector<Move> principalVariation;
+	};
+
+	/// <summary>
+	/// Finds the best move in a position with an iterative deepening alpha-beta search.
+	/// Each iteration is searched in an aspiration window around the score of the previous one,
+	/// and leaves are resolved with a quiescence search of captures. Moves are ordered by the
+	/// transposition table move, then captures by most valuable victim and least valuable attacker,
+	/// then killer moves and then the history of moves that caused cutoffs.
+	///
+	/// With more than one thread the search runs Lazy SMP: every thread searches the whole tree
+	/// on its own board, sharing results through the transposition table, while the helper threads
+	/// start on different depths and order quiet moves slightly differently to avoid duplicating work.
+	/// The main thread's result is returned. With a single thread the search is deterministic.
+	/// </summary>
+	class EXPORT Search
+	{
+	public:
+		/// <summary>
+		/// Constructs a search that stores its results in a transposition table.
+		/// </summary>
+		/// <param name="transpositionTable">The table to share results through, which must outlive the search</param>
+		/// <param name="threadCount">The number of threads to search with</param>
+		explicit Search(TranspositionTable& transpositionTable, unsigned int threadCount = 1);
+
+		virtual ~Search();
+
+		/// <summary>
+		/// Sets the number of threads used by later searches.
+		/// </summary>
+		/// <param name="threadCount">The number of threads, which is at least 1</param>
+		void setThreadCount(unsigned int threadCount);
+
+		/// <summary>
+		/// Gets the number of threads used by searches.
+		/// </summary>
+		/// <returns>The number of threads</returns>
+		unsigned int getThreadCount() const;
+
+		/// <summary>
+		/// Sets the endgame tablebases probed by later searches. Positions they cover are scored
+		/// from the tables instead of being searched, except at the root.
+		/// </summary>
+		/// <param name="pTablebase">The tablebases, or null to stop probing</param>
+		void setTablebase(std::shared_ptr<Tablebase const> pTablebase);
+
+		/// <summary>
+		/// Searches a position until a limit is reached or stop is called.
+		/// If stop was called since the last search finished, returns at once with a depth of 0 and
+		/// the first legal move. The board passed in is not modified.
+		/// </summary>
+		/// <param name="board">The position to search</param>
+		/// <param name="limits">When to stop searching</param>
+		/// <returns>The result of the deepest completed iteration</returns>
+		SearchResult search(Board const& board, SearchLimits const& limits);
+
+		/// <summary>
+		/// Searches a position reached in a game, scoring a return to any earlier position
+		/// of the game as a draw by repetition. The board passed in is not modified.
+		/// </summary>
+		/// <param name="board">The position to search</param>
+		/// <param name="limits">When to stop searching</param>
+		/// <param name="history">The positions of the game, ending with the position to search</param>
+		/// <returns>The result of the deepest completed iteration</returns>
+		SearchResult search(Board const& board, SearchLimits const& limits, PositionHistory const& history);
+
+		/// <summary>
+		/// Asks a running search to stop as soon as possible, or the next search to return at once
+		/// if none is running. The request is cleared when a search finishes. May be called from any thread.
+		/// </summary>
+		void stop();
+
+	private:
+		struct Impl;
+		std::unique_ptr<Impl> m_pImpl;
+	};
+}
+}
@@ -0,0 +1,117 @@
+// Author:	Liam Scholte
+// Created:	10/17/2026 10:14:52 PM
+// This file contains the class definition for Tablebase
+
+#pragma once
+
+#include <Chess/Macros.h>
+#include <Chess/Model/FwdDecl.h>
+#include <Chess/Model/Move.h>
+
+#include <memory>
+#include <string>
+
+namespace Chess
+{
+namespace Model
+{
+	/// <summary>
+	/// The outcome of a position with perfect play, as stored in a tablebase.
+	/// </summary>
+	struct EXPORT TablebaseResult
+	{
+		/// <summary>
+		/// 1 if the side to move wins, -1 if it loses and 0 if the position is drawn.
+		/// </summary>
+		int outcome;
+
+		/// <summary>
+		/// The number of plies until checkmate with perfect play, or 0 if the position is drawn.
+		/// A side that wins in n moves has 2n - 1 plies to mate.
+		/// </summary>
+		unsigned int pliesToMate;
+	};
+
+	/// <summary>
+	/// Endgame tablebases that know the outcome and distance to mate of every position with a few pieces.
+	///
+	/// Each table covers one set of material, such as KRvK, and is named after it with the stronger side first.
+	/// Tables are generated by retrograde analysis: starting from the checkmates, positions one move further
+	/// from mate are found on each pass by unmaking moves, and every candidate is confirmed by generating its
+	/// moves. Captures and promotions lead into smaller tables, which are generated first.
+	///
+	/// A table stores one byte per position, indexed by the side to move and the squares of the pieces, with the
+	/// white king kept in one corner of the board by symmetry. It is run length encoded in small blocks with
+	/// an index of where each block starts, so that a probe decodes a single block of the memory mapped file.
+	///
+	/// Positions with castling rights or an en passant target are not covered, and the fifty-move rule is ignored.
+	/// </summary>
+	class EXPORT Tablebase
+	{
+	public:
+		/// <summary>
+		/// The most pieces, counting the kings, a table can have.
+		/// </summary>
+		static int constexpr MAX_PIECES = 5;
+
+		/// <summary>
+		/// Constructs a tablebase without any tables.
+		/// </summary>
+		Tablebase();
+
+		/// <summary>
+		/// Memory maps every table in a directory.
+		/// </summary>
+		/// <param name="directory">The directory holding the table files</param>
+		/// <exception cref="std::runtime_error">Thrown if a table file is invalid</exception>
+		explicit Tablebase(std::string const& directory);
+
+		virtual ~Tablebase();
+
+		/// <summary>
+		/// Gets the number of tables that were loaded.
+		/// </summary>
+		/// <returns>The number of tables</returns>
+		std::size_t getTableCount() const;
+
+		/// <summary>
+		/// Gets the most pieces in any loaded table, so callers can skip probing positions with more.
+		/// </summary>
+		/// <returns>The most pieces, counting the kings, or 0 if no tables are loaded</returns>
+		int getMaxPieceCount() const;
+
+		/// <summary>
+		/// Looks up the outcome of a position. Positions with only the two kings are always found, and positions
+		/// without exactly one king per side, or whose block of a table file is corrupt, are never found.
+		/// </summary>
+		/// <param name="board">The position to look up</param>
+		/// <param name="result">Receives the outcome if the position is found</param>
+		/// <returns>True if the position is covered by a loaded table, false otherwise</returns>
+		bool probe(Board const& board, TablebaseResult& result) const;
+
+		/// <summary>
+		/// Finds a move that keeps the best outcome for the side to move: the fastest mate when winning,
+		/// a drawing move when drawing and the slowest mate when losing.
+		/// </summary>
+		/// <param name="board">The position to find a move in</param>
+		/// <returns>The best move, or a null move if the position or a position after one of its moves is not covered</returns>
+		Move findBestMove(Board const& board) const;
+
+		/// <summary>
+		/// Generates the table for a set of material, and the tables it depends on that are not already in
+		/// the directory, writing them to the directory. Passes over the table are split between threads.
+		/// </summary>
+		/// <param name="material">The material, such as "KQvK" or "KRPvKR", with each side's pieces from K, Q, R, B, N and P</param>
+		/// <param name="directory">The directory to write the tables to, which must exist</param>
+		/// <param name="threadCount">The number of threads to generate with</param>
+		/// <returns>The name of the generated table, with the stronger side first</returns>
+		/// <exception cref="std::invalid_argument">Thrown if the material is malformed or has too many pieces</exception>
+		/// <exception cref="std::runtime_error">Thrown if a table could not be written or an existing table file is invalid</exception>
+		static std::string generate(std::string const& material, std::string const& directory, unsigned int threadCount);
+
+	private:
+		struct Impl;
+		std::unique_ptr<Impl> m_pImpl;
+	};
+}
+}
@@ -0,0 +1,140 @@
+// Author:	Liam Scholte
+// Created:	10/17/2026 3:58:12 PM
+// This file contains the class definition for TranspositionTable
+
+#pragma once
+
+#include <Chess/Macros.h>
+#include <Chess/Model/Move.h>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+
+namespace Chess
+{
+namespace Model
+{
+	/// <summary>
+	/// How a stored score relates to the true score of a position.
+	/// </summary>
+	enum class Bound : unsigned char
+	{
+		None,
+
+		/// <summary>
+		/// The true score is at most the stored score (the search failed low).
+		/// </summary>
+		Upper,
+
+		/// <summary>
+		/// The true score is at least the stored score (the search failed high).
+		/// </summary>
+		Lower,
+
+		/// <summary>
+		/// The stored score is the true score.
+		/// </summary>
+		Exact
+	};
+
+	/// <summary>
+	/// The result of a search stored in a TranspositionTable.
+	/// </summary>
+	struct EXPORT TranspositionEntry
+	{
+		Move move;
+		int score;
+		int depth;
+		Bound bound;
+	};
+
+	/// <summary>
+	/// A fixed-size hash table of search results keyed by position hash that can be shared between threads without locks.
+	/// Entries are grouped four to a 64 byte bucket, so a probe touches a single cache line.
+	/// Each entry is stored as two 64-bit words, the data and the key XOR the data. An entry torn by
+	/// two threads writing at once no longer XORs back to its key, so a probe simply treats it as a miss.
+	/// </summary>
+	class EXPORT TranspositionTable
+	{
+	public:
+		/// <summary>
+		/// The smallest and largest depth that can be stored. Quiescence search uses negative depths.
+		/// </summary>
+		static int constexpr MIN_DEPTH = -64;
+		static int constexpr MAX_DEPTH = 191;
+
+		/// <summary>
+		/// Constructs an empty transposition table.
+		/// </summary>
+		/// <param name="sizeInMegabytes">The memory to use, which is rounded down to a power of two number of buckets</param>
+		explicit TranspositionTable(std::size_t sizeInMegabytes);
+
+		virtual ~TranspositionTable();
+
+		TranspositionTable(TranspositionTable const&) = delete;
+		TranspositionTable& operator=(TranspositionTable const&) = delete;
+
+		/// <summary>
+		/// Reallocates the table with a new size, discarding all entries.
+		/// Must not be called while other threads are using the table.
+		/// </summary>
+		/// <param name="sizeInMegabytes">The memory to use, which is rounded down to a power of two number of buckets</param>
+		void resize(std::size_t sizeInMegabytes);
+
+		/// <summary>
+		/// Gets the memory used by the table.
+		/// </summary>
+		/// <returns>The size of the table in bytes</returns>
+		std::size_t getSizeInBytes() const;
+
+		/// <summary>
+		/// Discards all entries. Must not be called while other threads are using the table.
+		/// </summary>
+		void clear();
+
+		/// <summary>
+		/// Marks the start of a new search. Entries from earlier searches are replaced in preference to current ones.
+		/// Must be called between searches rather than while threads are storing results.
+		/// </summary>
+		void newSearch();
+
+		/// <summary>
+		/// Looks up the stored result for a position.
+		/// </summary>
+		/// <param name="key">The Zobrist hash of the position</param>
+		/// <param name="entry">Receives the stored result if one is found</param>
+		/// <returns>True if a result was found, false otherwise</returns>
+		bool probe(std::uint64_t key, TranspositionEntry& entry) const;
+
+		/// <summary>
+		/// Stores the result of searching a position. A result for the same position is kept instead
+		/// if it was searched deeper in the current search, unless the new result is exact.
+		/// Otherwise the shallowest and oldest entry in the bucket is replaced.
+		/// </summary>
+		/// <param name="key">The Zobrist hash of the position</param>
+		/// <param name="move">The best move found, or a null move to keep any move already stored</param>
+		/// <param name="score">The score of the position, which must fit in 16 bits</param>
+		/// <param name="depth">The depth that was searched, clamped to [MIN_DEPTH, MAX_DEPTH]</param>
+		/// <param name="bound">How the score relates to the true score</param>
+		void store(std::uint64_t key, Move move, int score, int depth, Bound bound);
+
+		/// <summary>
+		/// Hints to the processor that the bucket for a position will be probed soon,
+		/// so that the memory access overlaps with work done before the probe.
+		/// </summary>
+		/// <param name="key">The Zobrist hash of the position</param>
+		void prefetch(std::uint64_t key) const;
+
+		/// <summary>
+		/// Estimates how full the table is by sampling the first thousand entries.
+		/// </summary>
+		/// <returns>The number of entries per thousand that belong to the current search</returns>
+		int getHashfull() const;
+
+	private:
+		struct Impl;
+		std::unique_ptr<Impl> m_pImpl;
+	};
+}
+}
@@ -0,0 +1,96 @@
+// Author:	Liam Scholte
+// Created:	10/17/2026 3:26:51 PM
+// This file contains the random keys used to hash chess positions
+
+#pragma once
+
+#include <Chess/Model/Bitboard.h>
+
+#include <cstdint>
+
+namespace Chess
+{
+namespace Model
+{
+	/// <summary>
+	/// The random keys that are combined with XOR to form the Zobrist hash of a position.
+	/// Every feature of a position has its own key, so making a move only
+	/// needs to XOR in the keys of the features that changed.
+	/// </summary>
+	struct ZobristKeys
+	{
+		/// <summary>
+		/// Keys for a piece on a square, indexed by color (0 = white, 1 = black), then PieceType, then Square.
+		/// </summary>
+		std::uint64_t pieces[2][6][SQUARE_COUNT];
+
+		/// <summary>
+		/// Key included when black is to move.
+		/// </summary>
+		std::uint64_t blackToMove;
+
+		/// <summary>
+		/// Keys for every combination of castling rights, indexed by the castling rights bit flags.
+		/// </summary>
+		std::uint64_t castlingRights[16];
+
+		/// <summary>
+		/// Keys for the file of the en passant target square, included only if a capture is possible.
+		/// </summary>
+		std::uint64_t enPassantFiles[8];
+	};
+
+	namespace Detail
+	{
+		/// <summary>
+		/// Fills in the keys with the splitmix64 generator from a fixed seed,
+		/// so hashes are the same in every build and every run.
+		/// </summary>
+		constexpr ZobristKeys generateZobristKeys()
+		{
+			ZobristKeys keys{};
+			std::uint64_t state = 0x5D588B656C078965ULL;
+			auto next = [&state]()
+			{
+				std::uint64_t z = (state += 0x9E3779B97F4A7C15ULL);
+				z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+				z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+				return z ^ (z >> 31);
+			};
+
+			for (auto& colorKeys : keys.pieces)
+			{
+				for (auto& typeKeys : colorKeys)
+				{
+					for (std::uint64_t& key : typeKeys)
+					{
+						key = next();
+					}
+				}
+			}
+			keys.blackToMove = next();
+
+			//No castling rights hashes to nothing, and every other combination is the XOR of its single rights
+			std::uint64_t singleRights[4] = { next(), next(), next(), next() };
+			for (int rights = 0; rights < 16; ++rights)
+			{
+				for (int i = 0; i < 4; ++i)
+				{
+					if (rights & (1 << i))
+					{
+						keys.castlingRights[rights] ^= singleRights[i];
+					}
+				}
+			}
+
+			for (std::uint64_t& key : keys.enPassantFiles)
+			{
+				key = next();
+			}
+			return keys;
+		}
+	}
+
+	inline constexpr ZobristKeys ZOBRIST_KEYS = Detail::generateZobristKeys();
+}
+}
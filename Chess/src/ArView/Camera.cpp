@@ -614,5 +614,17 @@ namespace ArView
 		std::scoped_lock lock(m_pImpl->mutex);
 		m_pImpl->pController->unselectPosition();
 	}
+
+	bool Camera::undoMove()
+	{
+		std::scoped_lock lock(m_pImpl->mutex);
+		return m_pImpl->pController->undoMove();
+	}
+
+	bool Camera::redoMove()
+	{
+		std::scoped_lock lock(m_pImpl->mutex);
+		return m_pImpl->pController->redoMove();
+	}
 }
 }
@@ -64,6 +64,7 @@ namespace ArView
 		std::shared_ptr<DrawableObject> pQuad;
 
 		std::shared_ptr<DrawableObject> pLegalMoveSquare;
+		std::shared_ptr<DrawableObject> pLosingCaptureSquare;
 		std::shared_ptr<DrawableObject> pSelectedPieceSquare;
 
 		std::shared_ptr<DrawableObject> pDrawableChessboard;
@@ -141,6 +142,18 @@ namespace ArView
 				pLegalMoveSquare = std::make_shared<Quad>(chessboardSquareVertices);
 			}
 
+			{
+				glm::vec4 highlightColor(1.0f, 0.0f, 0.0f, 0.5f);
+				std::vector<Vertex> chessboardSquareVertices =
+				{
+					VertexBuilder().addPosition(glm::vec3(-0.5f, -0.5f, 0.0f)).addColor(highlightColor).build(),
+					VertexBuilder().addPosition(glm::vec3(-0.5f, 0.5f, 0.0f)).addColor(highlightColor).build(),
+					VertexBuilder().addPosition(glm::vec3(0.5f, -0.5f, 0.0f)).addColor(highlightColor).build(),
+					VertexBuilder().addPosition(glm::vec3(0.5f, 0.5f, 0.0f)).addColor(highlightColor).build()
+				};
+				pLosingCaptureSquare = std::make_shared<Quad>(chessboardSquareVertices);
+			}
+
 			{
 				glm::vec4 highlightColor(0.0f, 0.0f, 1.0f, 0.5f);
 				std::vector<Vertex> chessboardSquareVertices =
@@ -390,9 +403,11 @@ namespace ArView
 				std::shared_ptr<Model::Piece const> pSelectedPiece = m_pImpl->pController->getSelectedPiece();
 				if (pSelectedPiece)
 				{
-					std::vector<Model::Position> legalMoves = pSelectedPiece->getLegalMoves(m_pImpl->pController->getGame().getBoard());
-					for (auto const& position : legalMoves)
+					Model::Board const& board = m_pImpl->pController->getGame().getBoard();
+					Model::MoveList legalMoves = m_pImpl->pController->getSelectedPieceLegalMoves();
+					for (Model::Move move : legalMoves)
 					{
+						Model::Position position = Model::toPosition(move.getTo());
 						glm::mat4 model(1.0f);
 						model = glm::translate(model, glm::vec3(position.file, position.rank, chessboardHeight + 0.001f));
 						model = glm::translate(model, translationVector);
@@ -400,7 +415,15 @@ namespace ArView
 						GLint modelUniformLocation = glGetUniformLocation(m_pImpl->objectShaderProgram, "Model");
 						glUniformMatrix4fv(modelUniformLocation, 1, GL_FALSE, &model[0][0]);
 
-						m_pImpl->pLegalMoveSquare->draw();
+						//Captures that lose material in the exchange that follows are shown in red
+						if (move.isCapture() && board.see(move) < 0)
+						{
+							m_pImpl->pLosingCaptureSquare->draw();
+						}
+						else
+						{
+							m_pImpl->pLegalMoveSquare->draw();
+						}
 					}
 					{
 						Model::Position position = pSelectedPiece->getPosition();
@@ -7,6 +7,7 @@
 
 #include <Chess/Model/Piece.h>
 #include <Chess/Model/Game.h>
+#include <Chess/Model/MoveList.h>
 #include <Chess/Model/Position.h>
 #include <Chess/Model/Board.h>
 
@@ -36,6 +37,15 @@ namespace Controller
 		return m_pImpl->pSelectedPiece;
 	}
 
+	Model::MoveList Controller::getSelectedPieceLegalMoves() const
+	{
+		if (!m_pImpl->pSelectedPiece)
+		{
+			return Model::MoveList();
+		}
+		return m_pImpl->game.getLegalMoves(m_pImpl->pSelectedPiece->getPosition());
+	}
+
 	void Controller::selectPosition(Model::Position position)
 	{
 
@@ -64,5 +74,17 @@ namespace Controller
 	{
 		m_pImpl->pSelectedPiece = nullptr;
 	}
+
+	bool Controller::undoMove()
+	{
+		m_pImpl->pSelectedPiece = nullptr;
+		return m_pImpl->game.undo();
+	}
+
+	bool Controller::redoMove()
+	{
+		m_pImpl->pSelectedPiece = nullptr;
+		return m_pImpl->game.redo();
+	}
 }
 }
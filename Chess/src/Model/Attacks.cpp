@@ -0,0 +1,255 @@
+// Author:	Liam Scholte
+// Created:	10/17/2026 1:37:05 PM
+// This file contains the implementations for Attacks
+// See Attacks.h for documentation
+
+#include <Chess/Model/Attacks.h>
+
+#include <cstddef>
+#include <vector>
+
+//Haswell and later processors, which introduced AVX2, also support BMI2
+#if defined(__BMI2__) || (defined(_MSC_VER) && defined(__AVX2__))
+#define CHESS_USE_PEXT
+#include <immintrin.h>
+#endif
+
+namespace Chess
+{
+namespace Model
+{
+	namespace
+	{
+		int constexpr ROOK_DIRECTIONS[4][2] = { { 1, 0 }, { -1, 0 }, { 0, 1 }, { 0, -1 } };
+		int constexpr BISHOP_DIRECTIONS[4][2] = { { 1, 1 }, { 1, -1 }, { -1, 1 }, { -1, -1 } };
+
+		/// <summary>
+		/// Walks each direction from a square one step at a time until the edge of the board
+		/// or an occupied square is reached. This is only used to fill in the lookup tables.
+		/// </summary>
+		Bitboard slidingAttacks(int const (&directions)[4][2], Square square, Bitboard occupancy)
+		{
+			Bitboard attacks = EMPTY_BITBOARD;
+			for (auto const& direction : directions)
+			{
+				int rank = square / 8 + direction[0];
+				int file = square % 8 + direction[1];
+				while (rank >= 0 && rank < 8 && file >= 0 && file < 8)
+				{
+					Bitboard bit = toBitboard(static_cast<Square>(rank * 8 + file));
+					attacks |= bit;
+					if (occupancy & bit)
+					{
+						break;
+					}
+					rank += direction[0];
+					file += direction[1];
+				}
+			}
+			return attacks;
+		}
+
+		/// <summary>
+		/// The xorshift64* generator used to search for magic numbers.
+		/// Fixed seeds keep the tables identical from run to run.
+		/// </summary>
+		class MagicRandom
+		{
+		public:
+			explicit MagicRandom(std::uint64_t seed)
+				: m_state(seed)
+			{}
+
+			std::uint64_t next()
+			{
+				m_state ^= m_state >> 12;
+				m_state ^= m_state << 25;
+				m_state ^= m_state >> 27;
+				return m_state * 2685821657736338717ULL;
+			}
+
+			/// <summary>
+			/// Gets a random number with roughly 1/8 of its bits set, which makes good magic candidates.
+			/// </summary>
+			std::uint64_t nextSparse()
+			{
+				return next() & next() & next();
+			}
+
+		private:
+			std::uint64_t m_state;
+		};
+
+		/// <summary>
+		/// Attack lookup for one type of sliding piece.
+		/// For each square, the relevant occupancy (the squares that could block the piece, excluding the board edge)
+		/// is hashed into an index into a shared table of precomputed attack sets.
+		/// </summary>
+		class SliderAttacks
+		{
+		public:
+			explicit SliderAttacks(int const (&directions)[4][2])
+			{
+				std::uint64_t constexpr seeds[8] = { 728, 10316, 55013, 32803, 12281, 15100, 16645, 255 };
+
+				std::vector<Bitboard> occupancies, references;
+				size_t offset = 0;
+				for (Square square = 0; square < SQUARE_COUNT; ++square)
+				{
+					//Edges only matter if the piece is on them, as nothing lies beyond them
+					Bitboard rankEdges = (Bitboard(0xFF) | Bitboard(0xFF) << 56) & ~(Bitboard(0xFF) << (square / 8 * 8));
+					Bitboard fileEdges = (Bitboard(0x0101010101010101) | Bitboard(0x0101010101010101) << 7) & ~(Bitboard(0x0101010101010101) << (square % 8));
+
+					Entry& entry = m_entries[square];
+					entry.mask = slidingAttacks(directions, square, EMPTY_BITBOARD) & ~(rankEdges | fileEdges);
+					entry.shift = static_cast<unsigned char>(64 - popCount(entry.mask));
+					entry.offset = offset;
+
+					//Enumerate every subset of the mask with the carry-rippler trick
+					occupancies.clear();
+					references.clear();
+					Bitboard subset = EMPTY_BITBOARD;
+					do
+					{
+						occupancies.push_back(subset);
+						references.push_back(slidingAttacks(directions, square, subset));
+						subset = (subset - entry.mask) & entry.mask;
+					} while (subset != EMPTY_BITBOARD);
+
+					offset += occupancies.size();
+					m_attacks.resize(offset);
+
+#if defined(CHESS_USE_PEXT)
+					for (size_t i = 0; i < occupancies.size(); ++i)
+					{
+						m_attacks[entry.offset + _pext_u64(occupancies[i], entry.mask)] = references[i];
+					}
+#else
+					findMagic(entry, occupancies, references, MagicRandom(seeds[square / 8]));
+#endif
+				}
+			}
+
+			Bitboard get(Square square, Bitboard occupancy) const
+			{
+				Entry const& entry = m_entries[square];
+#if defined(CHESS_USE_PEXT)
+				return m_attacks[entry.offset + _pext_u64(occupancy, entry.mask)];
+#else
+				return m_attacks[entry.offset + (((occupancy & entry.mask) * entry.magic) >> entry.shift)];
+#endif
+			}
+
+		private:
+			struct Entry
+			{
+				Bitboard mask;
+				Bitboard magic;
+				size_t offset;
+				unsigned char shift;
+			};
+
+			void findMagic(Entry& entry, std::vector<Bitboard> const& occupancies, std::vector<Bitboard> const& references, MagicRandom random)
+			{
+				//Track which attempt last wrote each slot so the table does not need clearing between attempts
+				std::vector<int> epochs(occupancies.size(), 0);
+				for (int attempt = 1; ; ++attempt)
+				{
+					do
+					{
+						entry.magic = random.nextSparse();
+					} while (popCount((entry.mask * entry.magic) >> 56) < 6);
+
+					size_t i = 0;
+					for (; i < occupancies.size(); ++i)
+					{
+						size_t index = static_cast<size_t>((occupancies[i] * entry.magic) >> entry.shift);
+						Bitboard& attacks = m_attacks[entry.offset + index];
+						if (epochs[index] != attempt)
+						{
+							epochs[index] = attempt;
+							attacks = references[i];
+						}
+						else if (attacks != references[i])
+						{
+							//Two occupancies with different attacks collide, so try another magic
+							break;
+						}
+					}
+
+					if (i == occupancies.size())
+					{
+						return;
+					}
+				}
+			}
+
+			Entry m_entries[SQUARE_COUNT];
+			std::vector<Bitboard> m_attacks;
+		};
+
+		SliderAttacks const rookAttacks(ROOK_DIRECTIONS);
+		SliderAttacks const bishopAttacks(BISHOP_DIRECTIONS);
+
+		/// <summary>
+		/// The squares between and the full line through every pair of aligned squares.
+		/// </summary>
+		struct AlignmentTables
+		{
+			Bitboard between[SQUARE_COUNT][SQUARE_COUNT];
+			Bitboard lines[SQUARE_COUNT][SQUARE_COUNT];
+
+			AlignmentTables()
+				: between{}
+				, lines{}
+			{
+				for (Square from = 0; from < SQUARE_COUNT; ++from)
+				{
+					for (Square to = 0; to < SQUARE_COUNT; ++to)
+					{
+						if (from == to)
+						{
+							continue;
+						}
+
+						for (auto directions : { &ROOK_DIRECTIONS, &BISHOP_DIRECTIONS })
+						{
+							if (slidingAttacks(*directions, from, EMPTY_BITBOARD) & toBitboard(to))
+							{
+								//Rays from both ends stop at each other, so they overlap only in between
+								between[from][to] = slidingAttacks(*directions, from, toBitboard(to))
+									& slidingAttacks(*directions, to, toBitboard(from));
+								lines[from][to] = (slidingAttacks(*directions, from, EMPTY_BITBOARD)
+									& slidingAttacks(*directions, to, EMPTY_BITBOARD))
+									| toBitboard(from) | toBitboard(to);
+							}
+						}
+					}
+				}
+			}
+		};
+
+		AlignmentTables const alignmentTables;
+	}
+
+	Bitboard getRookAttacks(Square square, Bitboard occupancy)
+	{
+		return rookAttacks.get(square, occupancy);
+	}
+
+	Bitboard getBishopAttacks(Square square, Bitboard occupancy)
+	{
+		return bishopAttacks.get(square, occupancy);
+	}
+
+	Bitboard getSquaresBetween(Square from, Square to)
+	{
+		return alignmentTables.between[from][to];
+	}
+
+	Bitboard getLine(Square from, Square to)
+	{
+		return alignmentTables.lines[from][to];
+	}
+}
+}
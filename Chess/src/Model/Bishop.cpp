@@ -6,6 +6,7 @@
 #include <Chess/Model/Bishop.h>
 #include <Chess/Model/Board.h>
 #include <Chess/Model/Position.h>
+#include <Chess/Model/Attacks.h>
 
 namespace Chess
 {
@@ -31,65 +32,10 @@ namespace Model
 		return PieceType::Bishop;
 	}
 
-	std::vector<Position> Bishop::getAttackingPositions(Board const& board) const
+	Bitboard Bishop::getAttackingSquares(Board const& board) const
 	{
-		std::vector<Position> attackingPositions;
-
-		Position currentPosition = getPosition();
-
-		auto checkAndPushPosition = [isWhite = isWhite(), currentPosition, &attackingPositions, &board](Position positionToCheck)
-		{
-			if (board.isPositionPossible(isWhite, positionToCheck))
-			{
-				attackingPositions.push_back(positionToCheck);
-			}
-		};
-
-		//Go up rank and up file
-		{
-			Position positionToCheck = currentPosition;
-			do
-			{
-				positionToCheck.rank += 1;
-				positionToCheck.file += 1;
-				checkAndPushPosition(positionToCheck);
-			} while (!board.getPiece(positionToCheck) && board.isPositionOnBoard(positionToCheck));
-		}
-
-		//Go down rank and up file
-		{
-			Position positionToCheck = currentPosition;
-			do
-			{
-				positionToCheck.rank -= 1;
-				positionToCheck.file += 1;
-				checkAndPushPosition(positionToCheck);
-			} while (!board.getPiece(positionToCheck) && board.isPositionOnBoard(positionToCheck));
-		}
-
-		//Go up rank and down file
-		{
-			Position positionToCheck = currentPosition;
-			do
-			{
-				positionToCheck.rank += 1;
-				positionToCheck.file -= 1;
-				checkAndPushPosition(positionToCheck);
-			} while (!board.getPiece(positionToCheck) && board.isPositionOnBoard(positionToCheck));
-		}
-
-		//Go down rank and down file
-		{
-			Position positionToCheck = currentPosition;
-			do
-			{
-				positionToCheck.rank -= 1;
-				positionToCheck.file -= 1;
-				checkAndPushPosition(positionToCheck);
-			} while (!board.getPiece(positionToCheck) && board.isPositionOnBoard(positionToCheck));
-		}
-
-		return attackingPositions;
+		Bitboard attacks = getBishopAttacks(toSquare(getPosition()), board.getOccupancy());
+		return attacks & ~board.getOccupancy(isWhite());
 	}
 }
 }
@@ -4,110 +4,1067 @@
 // See Board.h for documentation
 
 #include <Chess/Model/Board.h>
+#include <Chess/Model/Attacks.h>
+#include <Chess/Model/Evaluation.h>
 #include <Chess/Model/Position.h>
+#include <Chess/Model/Move.h>
+#include <Chess/Model/NeuralNetwork.h>
+#include <Chess/Model/PawnHashTable.h>
 #include <Chess/Model/Size.h>
 #include <Chess/Model/Piece.h>
 #include <Chess/Model/PieceFactory.h>
+#include <Chess/Model/Zobrist.h>
 
+#include <algorithm>
+#include <array>
+#include <cctype>
 #include <memory>
+#include <stdexcept>
+#include <string>
+#include <string_view>
 #include <unordered_set>
 
 namespace Chess
 {
 namespace Model
 {
+	namespace
+	{
+		/// <summary>
+		/// The castling rights kept when a piece moves from or to each square.
+		/// Moving the king or a rook from its starting square, or capturing a rook there, loses the matching rights.
+		/// </summary>
+		std::array<unsigned char, SQUARE_COUNT> constexpr CASTLING_RIGHTS_KEPT = []()
+		{
+			std::array<unsigned char, SQUARE_COUNT> kept{};
+			for (unsigned char& rights : kept)
+			{
+				rights = ALL_CASTLING;
+			}
+			kept[0] = ALL_CASTLING & ~WHITE_QUEENSIDE_CASTLING;
+			kept[4] = ALL_CASTLING & ~(WHITE_KINGSIDE_CASTLING | WHITE_QUEENSIDE_CASTLING);
+			kept[7] = ALL_CASTLING & ~WHITE_KINGSIDE_CASTLING;
+			kept[56] = ALL_CASTLING & ~BLACK_QUEENSIDE_CASTLING;
+			kept[60] = ALL_CASTLING & ~(BLACK_KINGSIDE_CASTLING | BLACK_QUEENSIDE_CASTLING);
+			kept[63] = ALL_CASTLING & ~BLACK_KINGSIDE_CASTLING;
+			return kept;
+		}();
+
+		/// <summary>
+		/// Gets the next space separated field of a FEN, or an empty field if there are none left.
+		/// </summary>
+		std::string_view nextField(std::string_view fen, std::size_t& index)
+		{
+			while (index < fen.size() && fen[index] == ' ')
+			{
+				++index;
+			}
+			std::size_t start = index;
+			while (index < fen.size() && fen[index] != ' ')
+			{
+				++index;
+			}
+			return fen.substr(start, index - start);
+		}
+
+		/// <summary>
+		/// Parses a move counter, which must consist of at most 9 digits so that it cannot overflow.
+		/// </summary>
+		bool parseCounter(std::string_view field, unsigned int& counter)
+		{
+			if (field.size() > 9)
+			{
+				return false;
+			}
+
+			counter = 0;
+			for (char c : field)
+			{
+				if (c < '0' || c > '9')
+				{
+					return false;
+				}
+				counter = counter * 10 + (c - '0');
+			}
+			return true;
+		}
+
+		/// <summary>
+		/// Writes a move counter in decimal and returns the position after it.
+		/// </summary>
+		char* writeCounter(char* pOutput, unsigned int counter)
+		{
+			char digits[10];
+			int count = 0;
+			do
+			{
+				digits[count++] = static_cast<char>('0' + counter % 10);
+				counter /= 10;
+			} while (counter != 0);
+
+			while (count > 0)
+			{
+				*pOutput++ = digits[--count];
+			}
+			return pOutput;
+		}
+	}
+
 	struct Board::Impl
 	{
-		PieceFactory whitePieceFactory, blackPieceFactory;
-		std::unordered_set<std::shared_ptr<Piece>> pieces, whitePieces, blackPieces;
-		std::shared_ptr<Piece> pWhiteKing, pBlackKing;
+		/// <summary>
+		/// Owns the accumulator of the neural network and gives a copy of the board its own copy of it.
+		/// </summary>
+		struct AccumulatorPtr : std::unique_ptr<NeuralNetwork::Accumulator>
+		{
+			AccumulatorPtr() = default;
+
+			AccumulatorPtr(AccumulatorPtr const& other)
+				: std::unique_ptr<NeuralNetwork::Accumulator>(other ? std::make_unique<NeuralNetwork::Accumulator>(*other) : nullptr)
+			{}
+
+			AccumulatorPtr& operator=(AccumulatorPtr const& other)
+			{
+				reset(other ? new NeuralNetwork::Accumulator(*other) : nullptr);
+				return *this;
+			}
+		};
+
+		//Mailbox of the piece on each square, indexed by Square
+		std::array<PieceCode, SQUARE_COUNT> squares;
+
+		//Occupancy indexed by color (0 = white, 1 = black) and then by PieceType
+		Bitboard colorBitboards[2];
+		Bitboard pieceBitboards[2][6];
+
+		//Attack maps kept up to date as pieces are added, removed and moved.
+		//pieceAttacks holds the squares attacked by the piece on each square,
+		//attackerCounts and attackedSquares are indexed by the color of the attackers.
+		Bitboard pieceAttacks[SQUARE_COUNT];
+		unsigned char attackerCounts[2][SQUARE_COUNT];
+		Bitboard attackedSquares[2];
+
+		bool isWhiteMove;
+		unsigned char castlingRights;
+		Square enPassantSquare;
+
+		//Halfmoves since the last capture or pawn move, and the number of the current full move
+		unsigned int halfmoveClock;
+		unsigned int fullmoveNumber;
+
+		//Zobrist hash of the position. The piece keys are toggled by addPiece, removePiece
+		//and movePiece, and the remaining keys wherever the corresponding state changes.
+		std::uint64_t hash;
+
+		//Zobrist hash of the pawns alone, toggled alongside the piece keys of pawns in hash
+		std::uint64_t pawnHash;
+
+		//Material and piece-square score from white's point of view and the game phase,
+		//both kept up to date by addPiece, removePiece and movePiece like the hash
+		TaperedScore pieceSquareScore;
+		int phase;
+
+		//The optional neural network and its accumulator, which is updated alongside pieceSquareScore.
+		//The accumulator is larger than the rest of the board, so it is only allocated while there is a network.
+		std::shared_ptr<NeuralNetwork const> pNetwork;
+		AccumulatorPtr pAccumulator;
 
 		Impl()
-			: whitePieceFactory(true)
-			, blackPieceFactory(false)
-		{			
-			//White
-			whitePieces.insert(whitePieceFactory.create(PieceType::Rook,	Position(1, 1)));
-			whitePieces.insert(whitePieceFactory.create(PieceType::Knight,	Position(1, 2)));
-			whitePieces.insert(whitePieceFactory.create(PieceType::Bishop,	Position(1, 3)));
-			whitePieces.insert(whitePieceFactory.create(PieceType::Queen,	Position(1, 4)));
-			pWhiteKing = *whitePieces.insert(whitePieceFactory.create(PieceType::King,	Position(1, 5))).first;
-			whitePieces.insert(whitePieceFactory.create(PieceType::Bishop,	Position(1, 6)));
-			whitePieces.insert(whitePieceFactory.create(PieceType::Knight,	Position(1, 7)));
-			whitePieces.insert(whitePieceFactory.create(PieceType::Rook,	Position(1, 8)));
+			: squares{}
+			, colorBitboards{}
+			, pieceBitboards{}
+			, pieceAttacks{}
+			, attackerCounts{}
+			, attackedSquares{}
+			, isWhiteMove(true)
+			, castlingRights(ALL_CASTLING)
+			, enPassantSquare(NO_SQUARE)
+			, halfmoveClock(0)
+			, fullmoveNumber(1)
+			, hash(ZOBRIST_KEYS.castlingRights[ALL_CASTLING])
+			, pawnHash(0)
+			, pieceSquareScore()
+			, phase(0)
+		{
+			PieceType constexpr backRankTypes[] =
+			{
+				PieceType::Rook, PieceType::Knight, PieceType::Bishop, PieceType::Queen,
+				PieceType::King, PieceType::Bishop, PieceType::Knight, PieceType::Rook
+			};
+
+			for (unsigned char file = 1; file <= 8; ++file)
+			{
+				//White
+				addPiece(true, backRankTypes[file - 1], Position(1, file));
+				addPiece(true, PieceType::Pawn, Position(2, file));
+
+				//Black
+				addPiece(false, backRankTypes[file - 1], Position(8, file));
+				addPiece(false, PieceType::Pawn, Position(7, file));
+			}
+		}
+
+		Impl(std::string_view fen)
+			: squares{}
+			, colorBitboards{}
+			, pieceBitboards{}
+			, pieceAttacks{}
+			, attackerCounts{}
+			, attackedSquares{}
+			, isWhiteMove(true)
+			, castlingRights(ALL_CASTLING)
+			, enPassantSquare(NO_SQUARE)
+			, halfmoveClock(0)
+			, fullmoveNumber(1)
+			, hash(ZOBRIST_KEYS.castlingRights[ALL_CASTLING])
+			, pawnHash(0)
+			, pieceSquareScore()
+			, phase(0)
+		{
+			//The message is only built once parsing has failed, so a valid FEN is parsed without allocating
+			auto invalidFen = [fen](char const* reason)
+			{
+				return std::invalid_argument("Invalid FEN (" + std::string(reason) + "): " + std::string(fen));
+			};
+
+			std::size_t index = 0;
+
+			//Piece placement starts at rank 8 file 1 and ends at rank 1 file 8
+			std::string_view placement = nextField(fen, index);
+			unsigned char rank = 8, file = 1;
+			for (char c : placement)
+			{
+				if (c == '/')
+				{
+					if (file != 9 || rank == 1)
+					{
+						throw invalidFen("rank does not have 8 files");
+					}
+					--rank;
+					file = 1;
+				}
+				else if (c >= '1' && c <= '8')
+				{
+					file += c - '0';
+					if (file > 9)
+					{
+						throw invalidFen("rank has more than 8 files");
+					}
+				}
+				else
+				{
+					PieceType type;
+					switch (std::tolower(static_cast<unsigned char>(c)))
+					{
+					case 'p': type = PieceType::Pawn; break;
+					case 'r': type = PieceType::Rook; break;
+					case 'n': type = PieceType::Knight; break;
+					case 'b': type = PieceType::Bishop; break;
+					case 'q': type = PieceType::Queen; break;
+					case 'k': type = PieceType::King; break;
+					default: throw invalidFen("unknown piece");
+					}
+
+					if (file > 8)
+					{
+						throw invalidFen("rank has more than 8 files");
+					}
+					addPiece(std::isupper(static_cast<unsigned char>(c)) != 0, type, Position(rank, file));
+					++file;
+				}
+			}
+			if (rank != 1 || file != 9)
+			{
+				throw invalidFen("board does not have 8 ranks");
+			}
+
+			//Side to move
+			std::string_view sideToMove = nextField(fen, index);
+			if (sideToMove != "w" && sideToMove != "b")
+			{
+				throw invalidFen("side to move must be w or b");
+			}
+			isWhiteMove = sideToMove == "w";
+			if (!isWhiteMove)
+			{
+				hash ^= ZOBRIST_KEYS.blackToMove;
+			}
+
+			//Reject positions that cannot arise in a game, since move generation and the tools built on it rely on them not occurring
+			Bitboard constexpr backRanks = Bitboard(0xFF) | Bitboard(0xFF) << 56;
+			for (int color = 0; color < 2; ++color)
+			{
+				if (popCount(pieceBitboards[color][typeIndex(PieceType::King)]) != 1)
+				{
+					throw invalidFen("each side must have exactly one king");
+				}
+				if (popCount(colorBitboards[color]) > 16)
+				{
+					throw invalidFen("a side has more than 16 pieces");
+				}
+				if (popCount(pieceBitboards[color][typeIndex(PieceType::Pawn)]) > 8)
+				{
+					throw invalidFen("a side has more than 8 pawns");
+				}
+				if (pieceBitboards[color][typeIndex(PieceType::Pawn)] & backRanks)
+				{
+					throw invalidFen("pawns cannot stand on the first or last rank");
+				}
+			}
+			if (pieceBitboards[colorIndex(!isWhiteMove)][typeIndex(PieceType::King)] & attackedSquares[colorIndex(isWhiteMove)])
+			{
+				throw invalidFen("the side not to move is in check");
+			}
+
+			//Castling availability
+			setCastlingRights(NO_CASTLING);
+			std::string_view castling = nextField(fen, index);
+			for (char c : castling == "-" ? std::string_view() : castling)
+			{
+				switch (c)
+				{
+				case 'K': setCastlingRights(castlingRights | WHITE_KINGSIDE_CASTLING); break;
+				case 'Q': setCastlingRights(castlingRights | WHITE_QUEENSIDE_CASTLING); break;
+				case 'k': setCastlingRights(castlingRights | BLACK_KINGSIDE_CASTLING); break;
+				case 'q': setCastlingRights(castlingRights | BLACK_QUEENSIDE_CASTLING); break;
+				default: throw invalidFen("unknown castling right");
+				}
+			}
+
+			//En passant target square
+			std::string_view enPassant = nextField(fen, index);
+			if (!enPassant.empty() && enPassant != "-")
+			{
+				if (enPassant.size() != 2 || enPassant[0] < 'a' || enPassant[0] > 'h' || enPassant[1] != (isWhiteMove ? '6' : '3'))
+				{
+					throw invalidFen("en passant target must be on the sixth rank for white or the third rank for black");
+				}
+				setEnPassantSquare(toSquare(Position(enPassant[1] - '0', enPassant[0] - 'a' + 1)));
+			}
+
+			//Move counters
+			std::string_view halfmoves = nextField(fen, index);
+			std::string_view fullmoves = nextField(fen, index);
+			if (!halfmoves.empty() && !parseCounter(halfmoves, halfmoveClock))
+			{
+				throw invalidFen("halfmove clock must be a number");
+			}
+			if (!fullmoves.empty() && (!parseCounter(fullmoves, fullmoveNumber) || fullmoveNumber == 0))
+			{
+				throw invalidFen("fullmove number must be a positive number");
+			}
+			if (!nextField(fen, index).empty())
+			{
+				throw invalidFen("unexpected text after the move counters");
+			}
+		}
+
+		Impl(Impl const& otherImpl) = default;
+
+		static int colorIndex(bool isWhite)
+		{
+			return isWhite ? 0 : 1;
+		}
+
+		static int typeIndex(PieceType type)
+		{
+			return static_cast<int>(type);
+		}
+
+		void addPiece(bool isWhite, PieceType type, Position position)
+		{
+			addPiece(toSquare(position), PieceCode(isWhite, type));
+		}
+
+		void addPiece(Square square, PieceCode piece)
+		{
+			bool isWhite = piece.isWhite();
+			PieceType type = piece.getType();
+
+			colorBitboards[colorIndex(isWhite)] |= toBitboard(square);
+			pieceBitboards[colorIndex(isWhite)][typeIndex(type)] |= toBitboard(square);
+			hash ^= ZOBRIST_KEYS.pieces[colorIndex(isWhite)][typeIndex(type)][square];
+			if (type == PieceType::Pawn)
+			{
+				pawnHash ^= ZOBRIST_KEYS.pieces[colorIndex(isWhite)][typeIndex(PieceType::Pawn)][square];
+			}
+			pieceSquareScore += PIECE_SQUARE_SCORES[colorIndex(isWhite)][typeIndex(type)][square];
+			phase += PHASE_WEIGHTS[typeIndex(type)];
+			if (pNetwork)
+			{
+				pNetwork->addPiece(*pAccumulator, isWhite, type, square);
+			}
 
-			whitePieces.insert(whitePieceFactory.create(PieceType::Pawn, Position(2, 1)));
-			whitePieces.insert(whitePieceFactory.create(PieceType::Pawn, Position(2, 2)));
-			whitePieces.insert(whitePieceFactory.create(PieceType::Pawn, Position(2, 3)));
-			whitePieces.insert(whitePieceFactory.create(PieceType::Pawn, Position(2, 4)));
-			whitePieces.insert(whitePieceFactory.create(PieceType::Pawn, Position(2, 5)));
-			whitePieces.insert(whitePieceFactory.create(PieceType::Pawn, Position(2, 6)));
-			whitePieces.insert(whitePieceFactory.create(PieceType::Pawn, Position(2, 7)));
-			whitePieces.insert(whitePieceFactory.create(PieceType::Pawn, Position(2, 8)));
+			squares[square] = piece;
 
-			//Black
-			blackPieces.insert(blackPieceFactory.create(PieceType::Rook,	Position(8, 1)));
-			blackPieces.insert(blackPieceFactory.create(PieceType::Knight,	Position(8, 2)));
-			blackPieces.insert(blackPieceFactory.create(PieceType::Bishop,	Position(8, 3)));
-			blackPieces.insert(blackPieceFactory.create(PieceType::Queen,	Position(8, 4)));
-			pBlackKing = *blackPieces.insert(blackPieceFactory.create(PieceType::King, Position(8, 5))).first;
-			blackPieces.insert(blackPieceFactory.create(PieceType::Bishop,	Position(8, 6)));
-			blackPieces.insert(blackPieceFactory.create(PieceType::Knight,	Position(8, 7)));
-			blackPieces.insert(blackPieceFactory.create(PieceType::Rook,	Position(8, 8)));
+			updateSlidingAttacks(toBitboard(square));
+			pieceAttacks[square] = computeAttacks(square);
+			addAttacks(colorIndex(isWhite), pieceAttacks[square]);
+		}
+
+		PieceCode removePiece(Square square)
+		{
+			PieceCode piece = squares[square];
+			bool isWhite = piece.isWhite();
+			PieceType type = piece.getType();
+
+			removeAttacks(colorIndex(isWhite), pieceAttacks[square]);
+			pieceAttacks[square] = EMPTY_BITBOARD;
+
+			colorBitboards[colorIndex(isWhite)] &= ~toBitboard(square);
+			pieceBitboards[colorIndex(isWhite)][typeIndex(type)] &= ~toBitboard(square);
+			hash ^= ZOBRIST_KEYS.pieces[colorIndex(isWhite)][typeIndex(type)][square];
+			if (type == PieceType::Pawn)
+			{
+				pawnHash ^= ZOBRIST_KEYS.pieces[colorIndex(isWhite)][typeIndex(PieceType::Pawn)][square];
+			}
+			pieceSquareScore -= PIECE_SQUARE_SCORES[colorIndex(isWhite)][typeIndex(type)][square];
+			phase -= PHASE_WEIGHTS[typeIndex(type)];
+			if (pNetwork)
+			{
+				pNetwork->removePiece(*pAccumulator, isWhite, type, square);
+			}
+
+			squares[square] = PieceCode();
+
+			updateSlidingAttacks(toBitboard(square));
+			return piece;
+		}
+
+		void movePiece(Square from, Square to)
+		{
+			PieceCode piece = squares[from];
+			squares[to] = piece;
+			squares[from] = PieceCode();
+			int color = colorIndex(piece.isWhite());
+			PieceType type = piece.getType();
+
+			removeAttacks(color, pieceAttacks[from]);
+			pieceAttacks[from] = EMPTY_BITBOARD;
 
-			blackPieces.insert(blackPieceFactory.create(PieceType::Pawn, Position(7, 1)));
-			blackPieces.insert(blackPieceFactory.create(PieceType::Pawn, Position(7, 2)));
-			blackPieces.insert(blackPieceFactory.create(PieceType::Pawn, Position(7, 3)));
-			blackPieces.insert(blackPieceFactory.create(PieceType::Pawn, Position(7, 4)));
-			blackPieces.insert(blackPieceFactory.create(PieceType::Pawn, Position(7, 5)));
-			blackPieces.insert(blackPieceFactory.create(PieceType::Pawn, Position(7, 6)));
-			blackPieces.insert(blackPieceFactory.create(PieceType::Pawn, Position(7, 7)));
-			blackPieces.insert(blackPieceFactory.create(PieceType::Pawn, Position(7, 8)));
+			Bitboard fromTo = toBitboard(from) | toBitboard(to);
+			colorBitboards[color] ^= fromTo;
+			pieceBitboards[color][typeIndex(type)] ^= fromTo;
+			std::uint64_t const (&pieceKeys)[SQUARE_COUNT] = ZOBRIST_KEYS.pieces[color][typeIndex(type)];
+			hash ^= pieceKeys[from] ^ pieceKeys[to];
+			if (type == PieceType::Pawn)
+			{
+				pawnHash ^= pieceKeys[from] ^ pieceKeys[to];
+			}
+			auto const& pieceSquareScores = PIECE_SQUARE_SCORES[color][typeIndex(type)];
+			pieceSquareScore += pieceSquareScores[to] - pieceSquareScores[from];
+			if (pNetwork)
+			{
+				pNetwork->movePiece(*pAccumulator, color == 0, type, from, to);
+			}
 
-			//Combined white & black
-			pieces.insert(whitePieces.cbegin(), whitePieces.cend());
-			pieces.insert(blackPieces.cbegin(), blackPieces.cend());
+			updateSlidingAttacks(fromTo);
+			pieceAttacks[to] = computeAttacks(to);
+			addAttacks(color, pieceAttacks[to]);
+		}
+
+		Bitboard computeAttacks(Square square) const
+		{
+			PieceCode piece = squares[square];
+			Bitboard occupancy = colorBitboards[0] | colorBitboards[1];
+			switch (piece.getType())
+			{
+			case PieceType::Pawn:
+				return PAWN_ATTACKS[colorIndex(piece.isWhite())][square];
+			case PieceType::Rook:
+				return getRookAttacks(square, occupancy);
+			case PieceType::Knight:
+				return KNIGHT_ATTACKS[square];
+			case PieceType::Bishop:
+				return getBishopAttacks(square, occupancy);
+			case PieceType::Queen:
+				return getQueenAttacks(square, occupancy);
+			case PieceType::King:
+				return KING_ATTACKS[square];
+			}
+			return EMPTY_BITBOARD;
+		}
+
+		void addAttacks(int color, Bitboard attacks)
+		{
+			while (attacks != EMPTY_BITBOARD)
+			{
+				Square square = popLowestSquare(attacks);
+				if (attackerCounts[color][square]++ == 0)
+				{
+					attackedSquares[color] |= toBitboard(square);
+				}
+			}
 		}
 
-		Impl(Impl const& otherImpl)
-			: whitePieceFactory(otherImpl.whitePieceFactory)
-			, blackPieceFactory(otherImpl.blackPieceFactory)
+		void removeAttacks(int color, Bitboard attacks)
 		{
-			for (std::shared_ptr<Piece> const& pPiece : otherImpl.whitePieces)
+			while (attacks != EMPTY_BITBOARD)
 			{
-				std::shared_ptr<Piece> pCopiedPiece = *whitePieces.insert(pPiece->clone()).first;
-				if (pCopiedPiece->getType() == PieceType::King)
+				Square square = popLowestSquare(attacks);
+				if (--attackerCounts[color][square] == 0)
 				{
-					pWhiteKing = pCopiedPiece;
+					attackedSquares[color] &= ~toBitboard(square);
 				}
 			}
+		}
 
-			for (std::shared_ptr<Piece> const& pPiece : otherImpl.blackPieces)
+		/// <summary>
+		/// Recomputes the attacks of sliding pieces after the occupancy of some squares has changed.
+		/// Only a slider that currently attacks one of the changed squares can have its rays
+		/// lengthened or shortened, so every other piece is left alone.
+		/// </summary>
+		void updateSlidingAttacks(Bitboard changedSquares)
+		{
+			for (int color = 0; color < 2; ++color)
 			{
-				std::shared_ptr<Piece> pCopiedPiece = *blackPieces.insert(pPiece->clone()).first;
-				if (pCopiedPiece->getType() == PieceType::King)
+				Bitboard sliders = pieceBitboards[color][typeIndex(PieceType::Rook)]
+					| pieceBitboards[color][typeIndex(PieceType::Bishop)]
+					| pieceBitboards[color][typeIndex(PieceType::Queen)];
+				while (sliders != EMPTY_BITBOARD)
 				{
-					pBlackKing = pCopiedPiece;
+					Square square = popLowestSquare(sliders);
+					Bitboard oldAttacks = pieceAttacks[square];
+					if ((oldAttacks & changedSquares) == EMPTY_BITBOARD)
+					{
+						continue;
+					}
+
+					Bitboard newAttacks = computeAttacks(square);
+					removeAttacks(color, oldAttacks & ~newAttacks);
+					addAttacks(color, newAttacks & ~oldAttacks);
+					pieceAttacks[square] = newAttacks;
 				}
 			}
+		}
+
+		void setCastlingRights(unsigned char rights)
+		{
+			hash ^= ZOBRIST_KEYS.castlingRights[castlingRights] ^ ZOBRIST_KEYS.castlingRights[rights];
+			castlingRights = rights;
+		}
+
+		/// <summary>
+		/// Sets the en passant target square, or clears it when given NO_SQUARE.
+		/// A target that no opposing pawn can capture on is not recorded.
+		/// </summary>
+		void setEnPassantSquare(Square square)
+		{
+			if (enPassantSquare != NO_SQUARE)
+			{
+				hash ^= ZOBRIST_KEYS.enPassantFiles[enPassantSquare % 8];
+				enPassantSquare = NO_SQUARE;
+			}
+
+			//A pawn of the side to move that attacks the target is one the target attacks as a pawn of the other side
+			int color = colorIndex(isWhiteMove);
+			if (square != NO_SQUARE && (PAWN_ATTACKS[1 - color][square] & pieceBitboards[color][typeIndex(PieceType::Pawn)]))
+			{
+				hash ^= ZOBRIST_KEYS.enPassantFiles[square % 8];
+				enPassantSquare = square;
+			}
+		}
+
+		/// <summary>
+		/// Gets the square of the rook a king castles with, which is in the corner on the side the king moves towards.
+		/// </summary>
+		static Square getCastlingRookSquare(Square kingFrom, Square kingTo)
+		{
+			return static_cast<Square>(kingTo > kingFrom ? kingTo + 1 : kingTo - 2);
+		}
+
+		void makeMove(Square from, Square to, PieceType promotion, UndoRecord& undoRecord)
+		{
+			undoRecord.castlingRights = castlingRights;
+			undoRecord.enPassantSquare = enPassantSquare;
+			undoRecord.halfmoveClock = halfmoveClock;
+			undoRecord.hash = hash;
+
+			//A pawn moving diagonally onto an empty square captures en passant, taking the pawn beside it
+			PieceCode movedPiece = squares[from];
+			PieceType movedType = movedPiece.getType();
+			Square capturedSquare = to;
+			if (movedType == PieceType::Pawn && squares[to].isEmpty() && from % 8 != to % 8)
+			{
+				capturedSquare = static_cast<Square>(isWhiteMove ? to - 8 : to + 8);
+			}
+
+			//The clock restarts on every irreversible move
+			bool isIrreversible = !squares[capturedSquare].isEmpty() || movedType == PieceType::Pawn;
+			halfmoveClock = isIrreversible ? 0 : halfmoveClock + 1;
+			if (!isWhiteMove)
+			{
+				++fullmoveNumber;
+			}
+
+			undoRecord.movedPiece = movedPiece;
+			undoRecord.capturedPiece = squares[capturedSquare].isEmpty() ? PieceCode() : removePiece(capturedSquare);
+			undoRecord.capturedSquare = capturedSquare;
+
+			movePiece(from, to);
+
+			//A king moving two squares is castling, and the rook jumps to the square the king passed over
+			if (movedType == PieceType::King && (to == from + 2 || from == to + 2))
+			{
+				movePiece(getCastlingRookSquare(from, to), static_cast<Square>((from + to) / 2));
+			}
+
+			bool isPawn = movedType == PieceType::Pawn;
+			Square lastRankStart = movedPiece.isWhite() ? 56 : 0;
+			if (isPawn && to >= lastRankStart && to < lastRankStart + 8 &&
+				promotion != PieceType::Pawn && promotion != PieceType::King)
+			{
+				removePiece(to);
+				addPiece(to, PieceCode(movedPiece.isWhite(), promotion));
+			}
+
+			if ((castlingRights & CASTLING_RIGHTS_KEPT[from] & CASTLING_RIGHTS_KEPT[to]) != castlingRights)
+			{
+				setCastlingRights(castlingRights & CASTLING_RIGHTS_KEPT[from] & CASTLING_RIGHTS_KEPT[to]);
+			}
+
+			isWhiteMove = !isWhiteMove;
+			hash ^= ZOBRIST_KEYS.blackToMove;
+
+			//The target is the square the pawn skipped over, which lies halfway between from and to
+			bool isDoublePush = isPawn && (to == from + 16 || from == to + 16);
+			setEnPassantSquare(isDoublePush ? static_cast<Square>((from + to) / 2) : NO_SQUARE);
+		}
+
+		void unmakeMove(Square from, Square to, UndoRecord const& undoRecord)
+		{
+			isWhiteMove = !isWhiteMove;
+			if (!isWhiteMove)
+			{
+				--fullmoveNumber;
+			}
+			halfmoveClock = undoRecord.halfmoveClock;
+
+			//A promoted piece is put back as the pawn that moved
+			if (squares[to] != undoRecord.movedPiece)
+			{
+				removePiece(to);
+				addPiece(to, undoRecord.movedPiece);
+			}
+
+			movePiece(to, from);
+
+			if (undoRecord.movedPiece.getType() == PieceType::King && (to == from + 2 || from == to + 2))
+			{
+				movePiece(static_cast<Square>((from + to) / 2), getCastlingRookSquare(from, to));
+			}
+
+			if (!undoRecord.capturedPiece.isEmpty())
+			{
+				addPiece(undoRecord.capturedSquare, undoRecord.capturedPiece);
+			}
+
+			castlingRights = undoRecord.castlingRights;
+			enPassantSquare = undoRecord.enPassantSquare;
+			hash = undoRecord.hash;
+		}
+
+		std::shared_ptr<Piece> createView(Square square) const
+		{
+			PieceCode piece = squares[square];
+			return PieceFactory(piece.isWhite()).create(piece.getType(), toPosition(square));
+		}
+
+		std::unordered_set<std::shared_ptr<Piece>> createViews(Bitboard bitboard) const
+		{
+			std::unordered_set<std::shared_ptr<Piece>> pieces;
+			while (bitboard)
+			{
+				pieces.insert(createView(popLowestSquare(bitboard)));
+			}
+			return pieces;
+		}
+
+		Bitboard getAttackers(Square square, int color, Bitboard occupancy) const
+		{
+			Bitboard const (&pieces)[6] = pieceBitboards[color];
+			Bitboard queens = pieces[typeIndex(PieceType::Queen)];
 
-			pieces.insert(whitePieces.cbegin(), whitePieces.cend());
-			pieces.insert(blackPieces.cbegin(), blackPieces.cend());
+			//A piece on the square attacks the same squares it can be attacked from
+			return (PAWN_ATTACKS[1 - color][square] & pieces[typeIndex(PieceType::Pawn)])
+				| (KNIGHT_ATTACKS[square] & pieces[typeIndex(PieceType::Knight)])
+				| (KING_ATTACKS[square] & pieces[typeIndex(PieceType::King)])
+				| (getBishopAttacks(square, occupancy) & (pieces[typeIndex(PieceType::Bishop)] | queens))
+				| (getRookAttacks(square, occupancy) & (pieces[typeIndex(PieceType::Rook)] | queens));
 		}
 
-		std::shared_ptr<Piece> addPiece(bool isWhite, PieceType type, Position position)
+		/// <summary>
+		/// Finds the least valuable of a set of attackers.
+		/// </summary>
+		Square getLeastValuableAttacker(Bitboard attackers, int color, PieceType& type) const
 		{
-			std::shared_ptr<Piece> pPiece;
-			if (isWhite)
+			for (PieceType candidate : { PieceType::Pawn, PieceType::Knight, PieceType::Bishop, PieceType::Rook, PieceType::Queen, PieceType::King })
+			{
+				Bitboard candidates = attackers & pieceBitboards[color][typeIndex(candidate)];
+				if (candidates != EMPTY_BITBOARD)
+				{
+					type = candidate;
+					return lowestSquare(candidates);
+				}
+			}
+			type = PieceType::King;
+			return NO_SQUARE;
+		}
+
+		/// <summary>
+		/// Evaluates an exchange with the swap algorithm. The gain of each successive capture is recorded
+		/// assuming the exchange goes on, then the list is folded back from the end, letting either side
+		/// stand pat instead of recapturing at a loss.
+		/// </summary>
+		int see(Move move) const
+		{
+			Square from = move.getFrom();
+			Square to = move.getTo();
+			int color = colorIndex(squares[from].isWhite());
+			Bitboard occupancy = (colorBitboards[0] | colorBitboards[1]) ^ toBitboard(from);
+
+			//An en passant capture takes a pawn that is not on the target square
+			int gains[32];
+			if (move.getFlag() == MoveFlag::EnPassantCapture)
 			{
-				pPiece = *whitePieces.insert(whitePieceFactory.create(type, position)).first;
+				gains[0] = EXCHANGE_VALUES[typeIndex(PieceType::Pawn)];
+				occupancy ^= toBitboard(color == 0 ? to - 8 : to + 8);
 			}
 			else
 			{
-				pPiece = *blackPieces.insert(blackPieceFactory.create(type, position)).first;
+				gains[0] = squares[to].isEmpty() ? 0 : EXCHANGE_VALUES[typeIndex(squares[to].getType())];
+			}
+
+			int onTargetValue = EXCHANGE_VALUES[typeIndex(squares[from].getType())];
+			if (move.isPromotion())
+			{
+				gains[0] += EXCHANGE_VALUES[typeIndex(move.getPromotion())] - EXCHANGE_VALUES[typeIndex(PieceType::Pawn)];
+				onTargetValue = EXCHANGE_VALUES[typeIndex(move.getPromotion())];
+			}
+
+			Bitboard bishops = pieceBitboards[0][typeIndex(PieceType::Bishop)] | pieceBitboards[1][typeIndex(PieceType::Bishop)]
+				| pieceBitboards[0][typeIndex(PieceType::Queen)] | pieceBitboards[1][typeIndex(PieceType::Queen)];
+			Bitboard rooks = pieceBitboards[0][typeIndex(PieceType::Rook)] | pieceBitboards[1][typeIndex(PieceType::Rook)]
+				| pieceBitboards[0][typeIndex(PieceType::Queen)] | pieceBitboards[1][typeIndex(PieceType::Queen)];
+			Bitboard attackers = (getAttackers(to, 0, occupancy) | getAttackers(to, 1, occupancy)) & occupancy;
+
+			int depth = 0;
+			while (depth < 31)
+			{
+				color = 1 - color;
+				PieceType type;
+				Square attacker = getLeastValuableAttacker(attackers & colorBitboards[color], color, type);
+				if (attacker == NO_SQUARE)
+				{
+					break;
+				}
+
+				++depth;
+				gains[depth] = onTargetValue - gains[depth - 1];
+
+				//Removing the attacker may reveal a slider lined up behind it
+				occupancy ^= toBitboard(attacker);
+				if (type == PieceType::Pawn || type == PieceType::Bishop || type == PieceType::Queen)
+				{
+					attackers |= getBishopAttacks(to, occupancy) & bishops;
+				}
+				if (type == PieceType::Rook || type == PieceType::Queen)
+				{
+					attackers |= getRookAttacks(to, occupancy) & rooks;
+				}
+				attackers &= occupancy;
+
+				//The king cannot capture onto a square that is still attacked
+				if (type == PieceType::King && (attackers & colorBitboards[1 - color]) != EMPTY_BITBOARD)
+				{
+					--depth;
+					break;
+				}
+				onTargetValue = EXCHANGE_VALUES[typeIndex(type)];
+			}
+
+			while (depth > 0)
+			{
+				--depth;
+				gains[depth] = -std::max(-gains[depth], gains[depth + 1]);
+			}
+			return gains[0];
+		}
+
+		/// <summary>
+		/// Gets the squares a piece could move to if its own king's safety were ignored.
+		/// </summary>
+		Bitboard getPseudoLegalTargets(Square square, int color) const
+		{
+			Bitboard occupancy = colorBitboards[0] | colorBitboards[1];
+			Bitboard targets = EMPTY_BITBOARD;
+			switch (squares[square].getType())
+			{
+			case PieceType::Pawn:
+			{
+				Bitboard empty = ~occupancy;
+				Bitboard singlePush = (color == 0 ? toBitboard(square) << 8 : toBitboard(square) >> 8) & empty;
+				Bitboard doublePush = EMPTY_BITBOARD;
+				if (square / 8 == (color == 0 ? 1 : 6))
+				{
+					doublePush = (color == 0 ? singlePush << 8 : singlePush >> 8) & empty;
+				}
+				return singlePush | doublePush | (PAWN_ATTACKS[color][square] & colorBitboards[1 - color]);
+			}
+			case PieceType::Rook:
+				targets = getRookAttacks(square, occupancy);
+				break;
+			case PieceType::Knight:
+				targets = KNIGHT_ATTACKS[square];
+				break;
+			case PieceType::Bishop:
+				targets = getBishopAttacks(square, occupancy);
+				break;
+			case PieceType::Queen:
+				targets = getQueenAttacks(square, occupancy);
+				break;
+			case PieceType::King:
+				targets = KING_ATTACKS[square];
+				break;
+			}
+			return targets & ~colorBitboards[color];
+		}
+
+		/// <summary>
+		/// Generates the castling moves of a king that is not in check. Castling needs the right to castle,
+		/// the rook still in its corner and only empty squares between them, and the king must not
+		/// pass over or land on a square the other side attacks, which the attack maps already hold.
+		/// </summary>
+		void generateCastlingMoves(int color, Square kingSquare, Bitboard targetSquares, MoveList& moves) const
+		{
+			Square homeSquare = color == 0 ? 4 : 60;
+			if (kingSquare != homeSquare)
+			{
+				return;
+			}
+
+			Bitboard occupancy = colorBitboards[0] | colorBitboards[1];
+			Bitboard rooks = pieceBitboards[color][typeIndex(PieceType::Rook)];
+			Bitboard attacked = attackedSquares[1 - color];
+			unsigned char kingsideRight = color == 0 ? WHITE_KINGSIDE_CASTLING : BLACK_KINGSIDE_CASTLING;
+			unsigned char queensideRight = color == 0 ? WHITE_QUEENSIDE_CASTLING : BLACK_QUEENSIDE_CASTLING;
+
+			Square kingsideTarget = static_cast<Square>(kingSquare + 2);
+			Bitboard kingsidePath = toBitboard(kingSquare + 1) | toBitboard(kingsideTarget);
+			if ((castlingRights & kingsideRight) && (rooks & toBitboard(kingSquare + 3))
+				&& (targetSquares & toBitboard(kingsideTarget))
+				&& (occupancy & kingsidePath) == EMPTY_BITBOARD && (attacked & kingsidePath) == EMPTY_BITBOARD)
+			{
+				moves.emplace_back(kingSquare, kingsideTarget, MoveFlag::KingCastle);
+			}
+
+			//The square next to the queenside rook must be empty, but the king does not cross it
+			Square queensideTarget = static_cast<Square>(kingSquare - 2);
+			Bitboard queensidePath = toBitboard(kingSquare - 1) | toBitboard(queensideTarget);
+			if ((castlingRights & queensideRight) && (rooks & toBitboard(kingSquare - 4))
+				&& (targetSquares & toBitboard(queensideTarget))
+				&& (occupancy & (queensidePath | toBitboard(kingSquare - 3))) == EMPTY_BITBOARD
+				&& (attacked & queensidePath) == EMPTY_BITBOARD)
+			{
+				moves.emplace_back(kingSquare, queensideTarget, MoveFlag::QueenCastle);
+			}
+		}
+
+		/// <summary>
+		/// Generates the en passant captures of the side to move. The capture is included if the target squares hold either
+		/// the square moved to or the pawn taken. Since it empties two squares at once, possibly both on the king's rank,
+		/// pins do not cover it, so each capture is checked by looking for attacks on the king with the occupancy after it.
+		/// </summary>
+		void generateEnPassantMoves(int color, Bitboard fromSquares, Bitboard targetSquares, Square kingSquare, MoveList& moves) const
+		{
+			int enemyColor = 1 - color;
+			Square capturedSquare = static_cast<Square>(color == 0 ? enPassantSquare - 8 : enPassantSquare + 8);
+			if ((targetSquares & (toBitboard(enPassantSquare) | toBitboard(capturedSquare))) == EMPTY_BITBOARD)
+			{
+				return;
+			}
+
+			Bitboard occupancy = colorBitboards[0] | colorBitboards[1];
+			Bitboard pawns = PAWN_ATTACKS[enemyColor][enPassantSquare] & pieceBitboards[color][typeIndex(PieceType::Pawn)] & fromSquares;
+			while (pawns != EMPTY_BITBOARD)
+			{
+				Square from = popLowestSquare(pawns);
+				Bitboard occupancyAfter = occupancy ^ toBitboard(from) ^ toBitboard(capturedSquare) ^ toBitboard(enPassantSquare);
+				Bitboard enemiesAfter = colorBitboards[enemyColor] ^ toBitboard(capturedSquare);
+				if (kingSquare == NO_SQUARE || (getAttackers(kingSquare, enemyColor, occupancyAfter) & enemiesAfter) == EMPTY_BITBOARD)
+				{
+					moves.emplace_back(from, enPassantSquare, MoveFlag::EnPassantCapture);
+				}
+			}
+		}
+
+		/// <summary>
+		/// Generates the legal moves to the target squares of the pieces of a color that stand on the given squares.
+		/// Checkers and pinned pieces are found once up front, so every move
+		/// emitted is legal without having to make it and look for check.
+		/// </summary>
+		void generateLegalMoves(int color, Bitboard fromSquares, Bitboard targetSquares, MoveList& moves) const
+		{
+			int enemyColor = 1 - color;
+			Bitboard occupancy = colorBitboards[0] | colorBitboards[1];
+			Bitboard king = pieceBitboards[color][typeIndex(PieceType::King)];
+			fromSquares &= colorBitboards[color];
+
+			//Without a king there is nothing to keep safe
+			Bitboard checkers = EMPTY_BITBOARD;
+			Bitboard pinned = EMPTY_BITBOARD;
+			Square kingSquare = 0;
+			if (king != EMPTY_BITBOARD)
+			{
+				kingSquare = lowestSquare(king);
+				checkers = getAttackers(kingSquare, enemyColor, occupancy);
+
+				//A piece is pinned if it is the only piece between the king and an enemy slider aimed at it
+				Bitboard enemyQueens = pieceBitboards[enemyColor][typeIndex(PieceType::Queen)];
+				Bitboard snipers =
+					(getRookAttacks(kingSquare, EMPTY_BITBOARD) & (pieceBitboards[enemyColor][typeIndex(PieceType::Rook)] | enemyQueens))
+					| (getBishopAttacks(kingSquare, EMPTY_BITBOARD) & (pieceBitboards[enemyColor][typeIndex(PieceType::Bishop)] | enemyQueens));
+				while (snipers != EMPTY_BITBOARD)
+				{
+					Bitboard blockers = getSquaresBetween(kingSquare, popLowestSquare(snipers)) & occupancy;
+					if (popCount(blockers) == 1)
+					{
+						pinned |= blockers & colorBitboards[color];
+					}
+				}
+
+				if (fromSquares & king)
+				{
+					//The king itself must not shadow the squares behind it from a checking slider
+					Bitboard targets = KING_ATTACKS[kingSquare] & ~colorBitboards[color] & targetSquares;
+					while (targets != EMPTY_BITBOARD)
+					{
+						Square to = popLowestSquare(targets);
+						if (getAttackers(to, enemyColor, occupancy ^ king) == EMPTY_BITBOARD)
+						{
+							moves.emplace_back(kingSquare, to, (colorBitboards[enemyColor] & toBitboard(to)) ? MoveFlag::Capture : MoveFlag::Quiet);
+						}
+					}
+
+					if (checkers == EMPTY_BITBOARD)
+					{
+						generateCastlingMoves(color, kingSquare, targetSquares, moves);
+					}
+				}
+				fromSquares &= ~king;
+			}
+
+			//In double check only the king can move
+			if (popCount(checkers) > 1)
+			{
+				return;
+			}
+
+			//In single check the checker must be captured or the check blocked
+			Bitboard evasionMask = targetSquares;
+			if (checkers != EMPTY_BITBOARD)
+			{
+				evasionMask &= checkers | getSquaresBetween(kingSquare, lowestSquare(checkers));
+			}
+
+			if (color == colorIndex(isWhiteMove) && enPassantSquare != NO_SQUARE)
+			{
+				generateEnPassantMoves(color, fromSquares, targetSquares, king != EMPTY_BITBOARD ? kingSquare : NO_SQUARE, moves);
+			}
+
+			while (fromSquares != EMPTY_BITBOARD)
+			{
+				Square from = popLowestSquare(fromSquares);
+				Bitboard targets = getPseudoLegalTargets(from, color) & evasionMask;
+				if (pinned & toBitboard(from))
+				{
+					//A pinned piece may only move along the line of the pin
+					targets &= getLine(kingSquare, from);
+				}
+
+				bool isPawn = (pieceBitboards[color][typeIndex(PieceType::Pawn)] & toBitboard(from)) != EMPTY_BITBOARD;
+				while (targets != EMPTY_BITBOARD)
+				{
+					Square to = popLowestSquare(targets);
+					bool isCapture = (colorBitboards[enemyColor] & toBitboard(to)) != EMPTY_BITBOARD;
+					MoveFlag flag = isCapture ? MoveFlag::Capture : MoveFlag::Quiet;
+					if (isPawn)
+					{
+						if (to / 8 == 0 || to / 8 == 7)
+						{
+							//The queen comes first since it is nearly always the best choice
+							MoveFlag queenPromotion = isCapture ? MoveFlag::QueenPromotionCapture : MoveFlag::QueenPromotion;
+							for (int i = 0; i < 4; ++i)
+							{
+								moves.emplace_back(from, to, static_cast<MoveFlag>(static_cast<int>(queenPromotion) - i));
+							}
+							continue;
+						}
+						else if (to == from + 16 || from == to + 16)
+						{
+							flag = MoveFlag::DoublePawnPush;
+						}
+					}
+					moves.emplace_back(from, to, flag);
+				}
+			}
+		}
+
+		/// <summary>
+		/// Scores the mobility of the knights, bishops, rooks and queens of both colors from white's point of view.
+		/// A piece's mobility is the number of squares it attacks that are not occupied by its own pieces
+		/// or attacked by enemy pawns, which the attack maps already hold.
+		/// </summary>
+		TaperedScore evaluateMobility() const
+		{
+			TaperedScore score;
+			for (int color = 0; color < 2; ++color)
+			{
+				Bitboard enemyPawns = pieceBitboards[1 - color][typeIndex(PieceType::Pawn)];
+				Bitboard enemyPawnAttacks = EMPTY_BITBOARD;
+				while (enemyPawns != EMPTY_BITBOARD)
+				{
+					enemyPawnAttacks |= pieceAttacks[popLowestSquare(enemyPawns)];
+				}
+				Bitboard available = ~colorBitboards[color] & ~enemyPawnAttacks;
+
+				TaperedScore colorScore;
+				for (PieceType type : { PieceType::Rook, PieceType::Knight, PieceType::Bishop, PieceType::Queen })
+				{
+					Bitboard pieces = pieceBitboards[color][typeIndex(type)];
+					while (pieces != EMPTY_BITBOARD)
+					{
+						int mobility = popCount(pieceAttacks[popLowestSquare(pieces)] & available);
+						colorScore += MOBILITY_WEIGHTS[typeIndex(type)] * (mobility - MOBILITY_BASELINES[typeIndex(type)]);
+					}
+				}
+				score += color == 0 ? colorScore : TaperedScore() - colorScore;
 			}
-			pieces.insert(pPiece);
-			return pPiece;
+			return score;
+		}
+
+		/// <summary>
+		/// Rewards passed pawns whose next square is empty, since nothing yet stands in the way of their advance.
+		/// Unlike the rest of the pawn structure this depends on the other pieces, so it cannot be cached with it.
+		/// </summary>
+		TaperedScore evaluateFreePassedPawns(PawnEvaluation const& pawnEvaluation) const
+		{
+			TaperedScore constexpr FREE_PASSED_PAWN_BONUS(5, 20);
+
+			Bitboard empty = ~(colorBitboards[0] | colorBitboards[1]);
+			int whiteCount = popCount((pawnEvaluation.passedPawns[0] << 8) & empty);
+			int blackCount = popCount((pawnEvaluation.passedPawns[1] >> 8) & empty);
+			return FREE_PASSED_PAWN_BONUS * (whiteCount - blackCount);
+		}
+
+		int evaluate(PawnEvaluation const& pawnEvaluation) const
+		{
+			TaperedScore score = pieceSquareScore
+				+ pawnEvaluation.score
+				+ evaluateFreePassedPawns(pawnEvaluation)
+				+ evaluateMobility();
+			int whiteScore = taper(score, phase);
+			return isWhiteMove ? whiteScore : -whiteScore;
 		}
 	};
 
@@ -115,6 +1072,10 @@ namespace Model
 		: m_pImpl(std::make_unique<Impl>())
 	{}
 
+	Board::Board(std::string_view fen)
+		: m_pImpl(std::make_unique<Impl>(fen))
+	{}
+
 	Board::Board(Board const& otherBoard)
 		: m_pImpl(std::make_unique<Impl>(*otherBoard.m_pImpl))
 	{
@@ -127,42 +1088,260 @@ namespace Model
 		return Size(8, 8);
 	}
 
-	std::unordered_set<std::shared_ptr<Piece>> const& Board::getPieces() const
+	bool Board::isWhiteMove() const
 	{
-		return m_pImpl->pieces;
+		return m_pImpl->isWhiteMove;
 	}
 
-	std::unordered_set<std::shared_ptr<Piece>> const& Board::getPieces(bool isWhite) const
+	unsigned char Board::getCastlingRights() const
 	{
-		return isWhite ? m_pImpl->whitePieces : m_pImpl->blackPieces;
+		return m_pImpl->castlingRights;
 	}
 
-	std::shared_ptr<Piece> Board::getPiece(Position position) const
+	Square Board::getEnPassantSquare() const
+	{
+		return m_pImpl->enPassantSquare;
+	}
+
+	unsigned int Board::getHalfmoveClock() const
+	{
+		return m_pImpl->halfmoveClock;
+	}
+
+	unsigned int Board::getFullmoveNumber() const
+	{
+		return m_pImpl->fullmoveNumber;
+	}
+
+	void Board::setFen(std::string_view fen)
+	{
+		//Parsing into a new position first leaves this one untouched if the FEN is malformed
+		std::unique_ptr<Impl> pImpl = std::make_unique<Impl>(fen);
+		std::swap(m_pImpl, pImpl);
+		setNeuralNetwork(std::move(pImpl->pNetwork));
+	}
+
+	std::size_t Board::writeFen(char (&buffer)[MAX_FEN_LENGTH]) const
+	{
+		char* pOutput = buffer;
+		for (int rank = 7; rank >= 0; --rank)
+		{
+			int emptyCount = 0;
+			for (int file = 0; file < 8; ++file)
+			{
+				PieceCode piece = m_pImpl->squares[rank * 8 + file];
+				if (piece.isEmpty())
+				{
+					++emptyCount;
+					continue;
+				}
+				if (emptyCount > 0)
+				{
+					*pOutput++ = static_cast<char>('0' + emptyCount);
+					emptyCount = 0;
+				}
+
+				char constexpr PIECE_LETTERS[] = { 'p', 'r', 'n', 'b', 'q', 'k' };
+				char letter = PIECE_LETTERS[Impl::typeIndex(piece.getType())];
+				*pOutput++ = piece.isWhite() ? static_cast<char>(std::toupper(static_cast<unsigned char>(letter))) : letter;
+			}
+			if (emptyCount > 0)
+			{
+				*pOutput++ = static_cast<char>('0' + emptyCount);
+			}
+			if (rank > 0)
+			{
+				*pOutput++ = '/';
+			}
+		}
+
+		*pOutput++ = ' ';
+		*pOutput++ = m_pImpl->isWhiteMove ? 'w' : 'b';
+
+		*pOutput++ = ' ';
+		unsigned char castlingRights = m_pImpl->castlingRights;
+		if (castlingRights == NO_CASTLING)
+		{
+			*pOutput++ = '-';
+		}
+		if (castlingRights & WHITE_KINGSIDE_CASTLING)
+		{
+			*pOutput++ = 'K';
+		}
+		if (castlingRights & WHITE_QUEENSIDE_CASTLING)
+		{
+			*pOutput++ = 'Q';
+		}
+		if (castlingRights & BLACK_KINGSIDE_CASTLING)
+		{
+			*pOutput++ = 'k';
+		}
+		if (castlingRights & BLACK_QUEENSIDE_CASTLING)
+		{
+			*pOutput++ = 'q';
+		}
+
+		*pOutput++ = ' ';
+		if (m_pImpl->enPassantSquare == NO_SQUARE)
+		{
+			*pOutput++ = '-';
+		}
+		else
+		{
+			*pOutput++ = static_cast<char>('a' + m_pImpl->enPassantSquare % 8);
+			*pOutput++ = static_cast<char>('1' + m_pImpl->enPassantSquare / 8);
+		}
+
+		*pOutput++ = ' ';
+		pOutput = writeCounter(pOutput, m_pImpl->halfmoveClock);
+		*pOutput++ = ' ';
+		pOutput = writeCounter(pOutput, m_pImpl->fullmoveNumber);
+		*pOutput = '\0';
+		return static_cast<std::size_t>(pOutput - buffer);
+	}
+
+	std::string Board::toFen() const
+	{
+		char buffer[MAX_FEN_LENGTH];
+		return std::string(buffer, writeFen(buffer));
+	}
+
+	std::uint64_t Board::getHash() const
+	{
+		return m_pImpl->hash;
+	}
+
+	std::uint64_t Board::getPawnHash() const
+	{
+		return m_pImpl->pawnHash;
+	}
+
+	int Board::evaluate() const
+	{
+		if (m_pImpl->pNetwork)
+		{
+			return m_pImpl->pNetwork->evaluate(*m_pImpl->pAccumulator, m_pImpl->isWhiteMove);
+		}
+
+		Bitboard const (&pieceBitboards)[2][6] = m_pImpl->pieceBitboards;
+		return m_pImpl->evaluate(evaluatePawnStructure(
+			pieceBitboards[0][Impl::typeIndex(PieceType::Pawn)],
+			pieceBitboards[1][Impl::typeIndex(PieceType::Pawn)]));
+	}
+
+	int Board::evaluate(PawnHashTable& pawnHashTable) const
+	{
+		if (m_pImpl->pNetwork)
+		{
+			return m_pImpl->pNetwork->evaluate(*m_pImpl->pAccumulator, m_pImpl->isWhiteMove);
+		}
+
+		Bitboard const (&pieceBitboards)[2][6] = m_pImpl->pieceBitboards;
+		return m_pImpl->evaluate(pawnHashTable.probe(m_pImpl->pawnHash,
+			pieceBitboards[0][Impl::typeIndex(PieceType::Pawn)],
+			pieceBitboards[1][Impl::typeIndex(PieceType::Pawn)]));
+	}
+
+	void Board::setNeuralNetwork(std::shared_ptr<NeuralNetwork const> pNetwork)
 	{
-		auto iter = std::find_if(
-			m_pImpl->pieces.cbegin(),
-			m_pImpl->pieces.cend(),
-			[position](std::shared_ptr<Piece> pPiece)
+		m_pImpl->pNetwork = std::move(pNetwork);
+		if (!m_pImpl->pNetwork)
+		{
+			m_pImpl->pAccumulator.reset();
+			return;
+		}
+
+		if (!m_pImpl->pAccumulator)
+		{
+			m_pImpl->pAccumulator.reset(new NeuralNetwork::Accumulator());
+		}
+		m_pImpl->pNetwork->reset(*m_pImpl->pAccumulator);
+		for (Square square = 0; square < SQUARE_COUNT; ++square)
+		{
+			PieceCode piece = m_pImpl->squares[square];
+			if (!piece.isEmpty())
 			{
-				return pPiece->getPosition() == position;
-			});
+				m_pImpl->pNetwork->addPiece(*m_pImpl->pAccumulator, piece.isWhite(), piece.getType(), square);
+			}
+		}
+	}
+
+	std::shared_ptr<NeuralNetwork const> const& Board::getNeuralNetwork() const
+	{
+		return m_pImpl->pNetwork;
+	}
+
+	std::unordered_set<std::shared_ptr<Piece>> Board::getPieces() const
+	{
+		return m_pImpl->createViews(m_pImpl->colorBitboards[0] | m_pImpl->colorBitboards[1]);
+	}
+
+	std::unordered_set<std::shared_ptr<Piece>> Board::getPieces(bool isWhite) const
+	{
+		return m_pImpl->createViews(m_pImpl->colorBitboards[Impl::colorIndex(isWhite)]);
+	}
+
+	std::shared_ptr<Piece> Board::getPiece(Position position) const
+	{
+		if (!isPositionOnBoard(position) || m_pImpl->squares[toSquare(position)].isEmpty())
+		{
+			return nullptr;
+		}
+		return m_pImpl->createView(toSquare(position));
+	}
 
-		return iter == m_pImpl->pieces.cend()
-			? nullptr
-			: *iter;
+	PieceCode Board::getPieceCode(Square square) const
+	{
+		return m_pImpl->squares[square];
+	}
+
+	Bitboard Board::getOccupancy() const
+	{
+		return m_pImpl->colorBitboards[0] | m_pImpl->colorBitboards[1];
+	}
+
+	Bitboard Board::getOccupancy(bool isWhite) const
+	{
+		return m_pImpl->colorBitboards[Impl::colorIndex(isWhite)];
+	}
+
+	Bitboard Board::getBitboard(bool isWhite, PieceType type) const
+	{
+		return m_pImpl->pieceBitboards[Impl::colorIndex(isWhite)][Impl::typeIndex(type)];
+	}
+
+	Bitboard Board::getAttackers(Square square, bool byWhite, Bitboard occupancy) const
+	{
+		return m_pImpl->getAttackers(square, Impl::colorIndex(byWhite), occupancy);
 	}
 
 	bool Board::removePiece(std::shared_ptr<Piece> pPiece)
 	{
-		if (pPiece->isWhite())
+		Position position = pPiece->getPosition();
+		if (!isPositionOnBoard(position) || m_pImpl->squares[toSquare(position)] != PieceCode(pPiece->isWhite(), pPiece->getType()))
 		{
-			m_pImpl->whitePieces.erase(pPiece);
+			//Piece is not on this board
+			return false;
 		}
-		else
+
+		m_pImpl->removePiece(toSquare(position));
+		return true;
+	}
+
+	bool Board::movePiece(Position currentPosition, Position newPosition)
+	{
+		if (!isPositionOnBoard(currentPosition) || m_pImpl->squares[toSquare(currentPosition)].isEmpty() || !isPositionOnBoard(newPosition))
 		{
-			m_pImpl->blackPieces.erase(pPiece);
+			return false;
 		}
-		return m_pImpl->pieces.erase(pPiece) > 0;
+
+		Square to = toSquare(newPosition);
+		if (!m_pImpl->squares[to].isEmpty())
+		{
+			m_pImpl->removePiece(to);
+		}
+		m_pImpl->movePiece(toSquare(currentPosition), to);
+		return true;
 	}
 
 	std::shared_ptr<Piece> Board::promotePiece(std::shared_ptr<Piece> pPieceToPromote, PieceType promotionType)
@@ -172,8 +1351,14 @@ namespace Model
 			return nullptr;
 		}
 
-		removePiece(pPieceToPromote);
-		return m_pImpl->addPiece(pPieceToPromote->isWhite(), promotionType, pPieceToPromote->getPosition());
+		if (!removePiece(pPieceToPromote))
+		{
+			return nullptr;
+		}
+
+		Square square = toSquare(pPieceToPromote->getPosition());
+		m_pImpl->addPiece(square, PieceCode(pPieceToPromote->isWhite(), promotionType));
+		return m_pImpl->createView(square);
 	}
 
 	bool Board::isPositionOnBoard(Position position) const
@@ -196,29 +1381,75 @@ namespace Model
 			return false;
 		}
 
-		auto iter = std::find_if(
-			m_pImpl->pieces.cbegin(),
-			m_pImpl->pieces.cend(),
-			[isWhite, position](std::shared_ptr<Piece> pPiece)
-			{
-				return pPiece->isWhite() == isWhite && pPiece->getPosition() == position;
-			});
-		if (iter != m_pImpl->pieces.cend())
+		//A piece of the same color must not exist in the position
+		return (getOccupancy(isWhite) & toBitboard(toSquare(position))) == EMPTY_BITBOARD;
+	}
+
+	bool Board::isKingInCheck(bool isWhite) const
+	{
+		return (getBitboard(isWhite, PieceType::King) & getAttackedSquares(!isWhite)) != EMPTY_BITBOARD;
+	}
+
+	Bitboard Board::getAttackedSquares(bool byWhite) const
+	{
+		return m_pImpl->attackedSquares[Impl::colorIndex(byWhite)];
+	}
+
+	int Board::getAttackerCount(Square square, bool byWhite) const
+	{
+		return m_pImpl->attackerCounts[Impl::colorIndex(byWhite)][square];
+	}
+
+	bool Board::isSquareAttacked(Square square, bool byWhite) const
+	{
+		return (getAttackedSquares(byWhite) & toBitboard(square)) != EMPTY_BITBOARD;
+	}
+
+	int Board::see(Move move) const
+	{
+		return m_pImpl->see(move);
+	}
+
+	bool Board::makeMove(Move move, UndoRecord& undoRecord)
+	{
+		if (m_pImpl->squares[move.getFrom()].isEmpty())
 		{
-			//A piece of the same color exists in the position
 			return false;
 		}
 
+		m_pImpl->makeMove(move.getFrom(), move.getTo(), move.getPromotion(), undoRecord);
 		return true;
 	}
 
-	bool Board::isKingInCheck(bool isWhite) const
+	void Board::unmakeMove(Move move, UndoRecord const& undoRecord)
+	{
+		m_pImpl->unmakeMove(move.getFrom(), move.getTo(), undoRecord);
+	}
+
+	MoveList Board::generateLegalMoves() const
 	{
-		return isWhite
-			? m_pImpl->pWhiteKing->isUnderAttack(*this)
-			: m_pImpl->pBlackKing->isUnderAttack(*this);
+		MoveList moves;
+		m_pImpl->generateLegalMoves(Impl::colorIndex(isWhiteMove()), FULL_BITBOARD, FULL_BITBOARD, moves);
+		return moves;
 	}
 
+	MoveList Board::generateLegalCaptures() const
+	{
+		MoveList moves;
+		m_pImpl->generateLegalMoves(Impl::colorIndex(isWhiteMove()), FULL_BITBOARD, getOccupancy(!isWhiteMove()), moves);
+		return moves;
+	}
+
+	MoveList Board::generateLegalMoves(Position position) const
+	{
+		MoveList moves;
+		PieceCode piece = isPositionOnBoard(position) ? m_pImpl->squares[toSquare(position)] : PieceCode();
+		if (!piece.isEmpty())
+		{
+			m_pImpl->generateLegalMoves(Impl::colorIndex(piece.isWhite()), toBitboard(toSquare(position)), FULL_BITBOARD, moves);
+		}
+		return moves;
+	}
 
 }
 }
@@ -0,0 +1,105 @@
+// Author:	Liam Scholte
+// Created:	10/17/2026 5:34:20 PM
+// This file contains the implementations for Evaluation
+// See Evaluation.h for documentation
+
+#include <Chess/Model/Evaluation.h>
+
+namespace Chess
+{
+namespace Model
+{
+	namespace
+	{
+		Bitboard constexpr FILE_BITBOARD = 0x0101010101010101ULL;
+
+		TaperedScore constexpr DOUBLED_PAWN_PENALTY(-10, -25);
+		TaperedScore constexpr ISOLATED_PAWN_PENALTY(-15, -20);
+
+		//Indexed by how many ranks the pawn has advanced from its own back rank
+		TaperedScore constexpr PASSED_PAWN_BONUSES[8] =
+		{
+			{ 0, 0 }, { 5, 10 }, { 10, 20 }, { 15, 35 }, { 25, 60 }, { 40, 90 }, { 60, 130 }, { 0, 0 }
+		};
+
+		/// <summary>
+		/// The squares on the files either side of a file.
+		/// </summary>
+		constexpr Bitboard getAdjacentFiles(int file)
+		{
+			Bitboard files = EMPTY_BITBOARD;
+			if (file > 0)
+			{
+				files |= FILE_BITBOARD << (file - 1);
+			}
+			if (file < 7)
+			{
+				files |= FILE_BITBOARD << (file + 1);
+			}
+			return files;
+		}
+
+		/// <summary>
+		/// The squares ahead of a pawn on its own and neighbouring files. A pawn
+		/// is passed if no enemy pawn stands on any of them. Indexed by color and then Square.
+		/// </summary>
+		std::array<std::array<Bitboard, SQUARE_COUNT>, 2> constexpr PASSED_PAWN_MASKS = []()
+		{
+			std::array<std::array<Bitboard, SQUARE_COUNT>, 2> masks{};
+			for (int square = 0; square < SQUARE_COUNT; ++square)
+			{
+				int rank = square / 8, file = square % 8;
+				Bitboard files = getAdjacentFiles(file) | (FILE_BITBOARD << file);
+				Bitboard ranksAbove = rank < 7 ? FULL_BITBOARD << (8 * (rank + 1)) : EMPTY_BITBOARD;
+				Bitboard ranksBelow = rank > 0 ? FULL_BITBOARD >> (8 * (8 - rank)) : EMPTY_BITBOARD;
+				masks[0][square] = files & ranksAbove;
+				masks[1][square] = files & ranksBelow;
+			}
+			return masks;
+		}();
+
+		/// <summary>
+		/// Scores the pawns of one color from that color's point of view and finds its passed pawns.
+		/// </summary>
+		TaperedScore evaluatePawns(int color, Bitboard pawns, Bitboard enemyPawns, Bitboard& passedPawns)
+		{
+			TaperedScore score;
+			for (int file = 0; file < 8; ++file)
+			{
+				int count = popCount(pawns & (FILE_BITBOARD << file));
+				if (count == 0)
+				{
+					continue;
+				}
+
+				score += DOUBLED_PAWN_PENALTY * (count - 1);
+				if ((pawns & getAdjacentFiles(file)) == EMPTY_BITBOARD)
+				{
+					score += ISOLATED_PAWN_PENALTY * count;
+				}
+			}
+
+			passedPawns = EMPTY_BITBOARD;
+			Bitboard remaining = pawns;
+			while (remaining != EMPTY_BITBOARD)
+			{
+				Square square = popLowestSquare(remaining);
+				if ((PASSED_PAWN_MASKS[color][square] & enemyPawns) == EMPTY_BITBOARD)
+				{
+					score += PASSED_PAWN_BONUSES[color == 0 ? square / 8 : 7 - square / 8];
+					passedPawns |= toBitboard(square);
+				}
+			}
+			return score;
+		}
+	}
+
+	PawnEvaluation evaluatePawnStructure(Bitboard whitePawns, Bitboard blackPawns)
+	{
+		PawnEvaluation evaluation;
+		evaluation.score = evaluatePawns(0, whitePawns, blackPawns, evaluation.passedPawns[0])
+			- evaluatePawns(1, blackPawns, whitePawns, evaluation.passedPawns[1]);
+		return evaluation;
+	}
+}
+}
@@ -5,22 +5,123 @@
 
 #include <Chess/Model/Game.h>
 #include <Chess/Model/Board.h>
+#include <Chess/Model/Move.h>
+#include <Chess/Model/MoveList.h>
+#include <Chess/Model/NeuralNetwork.h>
+#include <Chess/Model/OpeningBook.h>
 #include <Chess/Model/Position.h>
+#include <Chess/Model/PositionHistory.h>
 #include <Chess/Model/Piece.h>
+#include <Chess/Model/Tablebase.h>
+#include <Chess/Model/TranspositionTable.h>
+
+#include <algorithm>
+#include <random>
+#include <thread>
+#include <utility>
+#include <vector>
 
 namespace Chess
 {
 namespace Model
 {
 
+	namespace
+	{
+		std::size_t constexpr TRANSPOSITION_TABLE_MEGABYTES = 16;
+
+		/// <summary>
+		/// A move of the game along with what is needed to take it back.
+		/// </summary>
+		struct PlayedMove
+		{
+			Move move;
+			UndoRecord undoRecord;
+		};
+
+		/// <summary>
+		/// Leaves a core free for rendering and tracking while the game searches.
+		/// </summary>
+		unsigned int getSearchThreadCount()
+		{
+			unsigned int coreCount = std::thread::hardware_concurrency();
+			return coreCount > 1 ? coreCount - 1 : 1;
+		}
+	}
+
 	struct Game::Impl
 	{
-		bool isWhiteMove;
 		Board board;
 
+		//Every position of the game so far, ending with the current one
+		PositionHistory history;
+
+		//The moves that can be taken back, oldest first, and the moves taken back that can be played again, most recent last
+		std::vector<PlayedMove> playedMoves;
+		std::vector<Move> undoneMoves;
+
+		//Created by the first search, since games that are only replayed never need them
+		std::unique_ptr<TranspositionTable> pTranspositionTable;
+		std::unique_ptr<Search> pSearch;
+
+		std::unique_ptr<OpeningBook> pOpeningBook;
+		std::shared_ptr<Tablebase const> pTablebase;
+
+		//Picks between book moves, so that the same opening is not played every game
+		std::mt19937 random;
+
+		//The legal moves of the side to move. They are generated whenever the position changes, whether by
+		//a move, an undo, a redo or a new FEN, so that reading them never modifies the game.
+		MoveList legalMoves;
+
 		Impl()
-			: isWhiteMove(true)
-		{}
+			: random(std::random_device()())
+		{
+			recordPosition();
+		}
+
+		Impl(std::string_view fen)
+			: board(fen)
+			, random(std::random_device()())
+		{
+			recordPosition();
+		}
+
+		/// <summary>
+		/// Records the new current position and generates its legal moves.
+		/// </summary>
+		void recordPosition()
+		{
+			history.push(board.getHash(), board.getHalfmoveClock());
+			legalMoves = board.generateLegalMoves();
+		}
+
+		bool makeMove(Move move)
+		{
+			PlayedMove playedMove = { move, UndoRecord() };
+			if (!board.makeMove(move, playedMove.undoRecord))
+			{
+				return false;
+			}
+
+			playedMoves.push_back(std::move(playedMove));
+			recordPosition();
+			return true;
+		}
+
+		/// <summary>
+		/// Makes a new move, which replaces any moves that were taken back.
+		/// </summary>
+		bool playMove(Move move)
+		{
+			if (!makeMove(move))
+			{
+				return false;
+			}
+
+			undoneMoves.clear();
+			return true;
+		}
 	};
 
 	Game::Game()
@@ -28,11 +129,16 @@ namespace Model
 	{
 	}
 
+	Game::Game(std::string_view fen)
+		: m_pImpl(std::make_unique<Impl>(fen))
+	{
+	}
+
 	Game::~Game() = default;
 
 	bool Game::isWhiteMove() const
 	{
-		return m_pImpl->isWhiteMove;
+		return m_pImpl->board.isWhiteMove();
 	}
 
 	Board const& Game::getBoard() const
@@ -40,39 +146,230 @@ namespace Model
 		return m_pImpl->board;
 	}
 
+	std::uint64_t Game::getHash() const
+	{
+		return m_pImpl->board.getHash();
+	}
+
+	void Game::setFen(std::string_view fen)
+	{
+		m_pImpl->board.setFen(fen);
+
+		//Positions before the new one can no longer repeat or be returned to
+		m_pImpl->history.clear();
+		m_pImpl->recordPosition();
+		m_pImpl->playedMoves.clear();
+		m_pImpl->undoneMoves.clear();
+	}
+
+	std::string Game::toFen() const
+	{
+		return m_pImpl->board.toFen();
+	}
+
+	MoveList const& Game::getLegalMoves() const
+	{
+		return m_pImpl->legalMoves;
+	}
+
+	MoveList Game::getLegalMoves(Position position) const
+	{
+		Board const& board = m_pImpl->board;
+		PieceCode piece = board.isPositionOnBoard(position) ? board.getPieceCode(toSquare(position)) : PieceCode();
+		if (piece.isEmpty() || piece.isWhite() != isWhiteMove())
+		{
+			//The other side's pieces cannot move until it is their turn, so their moves are not kept
+			return board.generateLegalMoves(position);
+		}
+
+		MoveList moves;
+		Square from = toSquare(position);
+		for (Move move : m_pImpl->legalMoves)
+		{
+			if (move.getFrom() == from)
+			{
+				moves.push_back(move);
+			}
+		}
+		return moves;
+	}
+
 	bool Game::move(Position currentPosition, Position newPosition)
 	{
-		std::shared_ptr<Piece> pPiece = m_pImpl->board.getPiece(currentPosition);
-		if (!pPiece)
+		return move(currentPosition, newPosition, PieceType::Queen);
+	}
+
+	bool Game::move(Position currentPosition, Position newPosition, PieceType promotion)
+	{
+		Board const& board = m_pImpl->board;
+		PieceCode piece = board.isPositionOnBoard(currentPosition) ? board.getPieceCode(toSquare(currentPosition)) : PieceCode();
+		if (piece.isEmpty())
 		{
 			//No piece exists at current position
 			return false;
 		}
 
-		if (pPiece->isWhite() != isWhiteMove())
+		if (piece.isWhite() != isWhiteMove())
 		{
 			//Selected piece is not the correct color for moving
 			return false;
 		}
 
-		std::vector<Position> legalPositions = pPiece->getLegalMoves(getBoard());
-		auto legalPositionIter = std::find_if(
-			legalPositions.cbegin(),
-			legalPositions.cend(),
-			[newPosition](Position position)
+		//The piece only moves if the new position is legal for it. Make the generated move
+		//rather than one built from the positions, so that it carries the capture, castling, en passant and promotion flags
+		Square to = toSquare(newPosition);
+		for (Move move : getLegalMoves(currentPosition))
+		{
+			if (move.getTo() == to && (!move.isPromotion() || move.getPromotion() == promotion))
 			{
-				return position == newPosition;
-			});
-		if (legalPositionIter == legalPositions.cend())
+				return m_pImpl->playMove(move);
+			}
+		}
+		return false;
+	}
+
+	bool Game::move(Move move)
+	{
+		if (!m_pImpl->legalMoves.contains(move))
 		{
-			//Position is not legal for the selected piece
 			return false;
 		}
 
-		pPiece->move(m_pImpl->board, newPosition);
-		m_pImpl->isWhiteMove = !m_pImpl->isWhiteMove;
+		return m_pImpl->playMove(move);
+	}
+
+	bool Game::canUndo() const
+	{
+		return !m_pImpl->playedMoves.empty();
+	}
+
+	bool Game::canRedo() const
+	{
+		return !m_pImpl->undoneMoves.empty();
+	}
+
+	bool Game::undo()
+	{
+		if (!canUndo())
+		{
+			return false;
+		}
 
+		PlayedMove const& playedMove = m_pImpl->playedMoves.back();
+		m_pImpl->board.unmakeMove(playedMove.move, playedMove.undoRecord);
+		m_pImpl->undoneMoves.push_back(playedMove.move);
+		m_pImpl->playedMoves.pop_back();
+		m_pImpl->history.pop();
+		m_pImpl->legalMoves = m_pImpl->board.generateLegalMoves();
 		return true;
 	}
+
+	bool Game::redo()
+	{
+		if (!canRedo())
+		{
+			return false;
+		}
+
+		//The move was legal when it was first made, and undoing has restored the position it was made in
+		Move move = m_pImpl->undoneMoves.back();
+		m_pImpl->undoneMoves.pop_back();
+		return m_pImpl->makeMove(move);
+	}
+
+	PositionHistory const& Game::getPositionHistory() const
+	{
+		return m_pImpl->history;
+	}
+
+	bool Game::isThreefoldRepetition() const
+	{
+		return m_pImpl->history.isThreefoldRepetition();
+	}
+
+	bool Game::isFiftyMoveDraw() const
+	{
+		return m_pImpl->history.isFiftyMoveDraw();
+	}
+
+	SearchResult Game::findBestMove(SearchLimits const& limits)
+	{
+		if (m_pImpl->pOpeningBook)
+		{
+			Move bookMove = m_pImpl->pOpeningBook->chooseMove(m_pImpl->board, m_pImpl->random());
+			if (bookMove != Move())
+			{
+				SearchResult result;
+				result.bestMove = bookMove;
+				result.principalVariation.push_back(bookMove);
+				return result;
+			}
+		}
+
+		TablebaseResult tablebaseResult;
+		if (probeTablebase(tablebaseResult))
+		{
+			//Follow the tables to mate, or for as long as the search would, to give the line of play
+			SearchResult result;
+			int score = MATE_SCORE - static_cast<int>(tablebaseResult.pliesToMate);
+			result.score = tablebaseResult.outcome == 0 ? 0 : tablebaseResult.outcome > 0 ? score : -score;
+			Board board(m_pImpl->board);
+			unsigned int length = std::min<unsigned int>(std::max(tablebaseResult.pliesToMate, 1u), MAX_PLY);
+			for (unsigned int ply = 0; ply < length; ++ply)
+			{
+				Move move = m_pImpl->pTablebase->findBestMove(board);
+				if (move == Move())
+				{
+					break;
+				}
+				UndoRecord undoRecord;
+				board.makeMove(move, undoRecord);
+				result.principalVariation.push_back(move);
+			}
+			if (!result.principalVariation.empty())
+			{
+				result.bestMove = result.principalVariation.front();
+				return result;
+			}
+		}
+
+		if (!m_pImpl->pSearch)
+		{
+			m_pImpl->pTranspositionTable = std::make_unique<TranspositionTable>(TRANSPOSITION_TABLE_MEGABYTES);
+			m_pImpl->pSearch = std::make_unique<Search>(*m_pImpl->pTranspositionTable, getSearchThreadCount());
+			m_pImpl->pSearch->setTablebase(m_pImpl->pTablebase);
+		}
+		return m_pImpl->pSearch->search(m_pImpl->board, limits, m_pImpl->history);
+	}
+
+	void Game::loadNeuralNetwork(std::string const& path)
+	{
+		m_pImpl->board.setNeuralNetwork(std::make_shared<NeuralNetwork const>(path));
+
+		//Stored scores came from the old evaluation
+		if (m_pImpl->pTranspositionTable)
+		{
+			m_pImpl->pTranspositionTable->clear();
+		}
+	}
+
+	void Game::loadOpeningBook(std::string const& path)
+	{
+		m_pImpl->pOpeningBook = std::make_unique<OpeningBook>(path);
+	}
+
+	void Game::loadTablebases(std::string const& directory)
+	{
+		m_pImpl->pTablebase = std::make_shared<Tablebase const>(directory);
+		if (m_pImpl->pSearch)
+		{
+			m_pImpl->pSearch->setTablebase(m_pImpl->pTablebase);
+		}
+	}
+
+	bool Game::probeTablebase(TablebaseResult& result) const
+	{
+		return m_pImpl->pTablebase && m_pImpl->pTablebase->probe(m_pImpl->board, result);
+	}
 }
 }
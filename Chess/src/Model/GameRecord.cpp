@@ -0,0 +1,256 @@
+// Author:	Liam Scholte
+// Created:	10/17/2026 9:02:44 PM
+// This file contains the implementations for GameRecordWriter and GameRecordReader
+// See GameRecord.h for documentation
+
+#include <Chess/Model/GameRecord.h>
+#include <Chess/Model/Board.h>
+#include <Chess/Model/MemoryMappedFile.h>
+
+#include <algorithm>
+#include <fstream>
+#include <stdexcept>
+
+namespace Chess
+{
+namespace Model
+{
+	namespace
+	{
+		//The file starts with a header, then the games one after another and finally the index,
+		//which holds the 64-bit offset of each game. Values are stored in the byte order of the machine
+		char constexpr MAGIC[4] = { 'A', 'R', 'C', 'G' };
+		std::uint32_t constexpr VERSION = 1;
+		std::size_t constexpr HEADER_SIZE = 32;
+
+		//Each game starts with its ply count, result and FEN length. The FEN follows, padded
+		//to an even length so that the moves stay two byte aligned
+		std::size_t constexpr GAME_HEADER_SIZE = 8;
+
+		struct FileHeader
+		{
+			char magic[4];
+			std::uint32_t version;
+			std::uint64_t gameCount;
+			std::uint64_t indexOffset;
+			std::uint64_t reserved;
+		};
+		static_assert(sizeof(FileHeader) == HEADER_SIZE, "The file header must match the file format");
+
+		struct GameHeader
+		{
+			std::uint32_t plyCount;
+			GameResult result;
+			std::uint8_t fenLength;
+			std::uint16_t reserved;
+		};
+		static_assert(sizeof(GameHeader) == GAME_HEADER_SIZE, "The game header must match the file format");
+	}
+
+	struct GameRecordWriter::Impl
+	{
+		std::ofstream file;
+		std::string path;
+		std::vector<std::uint64_t> offsets;
+		std::uint64_t size;
+		std::vector<unsigned char> buffer;
+
+		Impl(std::string const& path)
+			: file(path, std::ios::binary | std::ios::trunc)
+			, path(path)
+			, size(HEADER_SIZE)
+		{
+			if (!file.is_open())
+			{
+				throw std::runtime_error("Could not create game record file: " + path);
+			}
+
+			//The header is written again with the real counts once every game has been added
+			FileHeader header = {};
+			file.write(reinterpret_cast<char const*>(&header), sizeof(header));
+		}
+
+		void write(void const* pData, std::size_t size)
+		{
+			unsigned char const* pBytes = static_cast<unsigned char const*>(pData);
+			buffer.insert(buffer.end(), pBytes, pBytes + size);
+		}
+	};
+
+	GameRecordWriter::GameRecordWriter(std::string const& path)
+		: m_pImpl(std::make_unique<Impl>(path))
+	{}
+
+	GameRecordWriter::~GameRecordWriter()
+	{
+		try
+		{
+			finish();
+		}
+		catch (std::exception const&)
+		{
+		}
+	}
+
+	void GameRecordWriter::addGame(std::string_view startFen, std::vector<Move> const& moves, GameResult result)
+	{
+		if (startFen.size() >= MAX_FEN_LENGTH)
+		{
+			throw std::invalid_argument("FEN is too long to be valid");
+		}
+		if (!m_pImpl->file.is_open())
+		{
+			return;
+		}
+
+		GameHeader header = {};
+		header.plyCount = static_cast<std::uint32_t>(moves.size());
+		header.result = result;
+		header.fenLength = static_cast<std::uint8_t>(startFen.size());
+
+		m_pImpl->buffer.clear();
+		m_pImpl->write(&header, sizeof(header));
+		m_pImpl->write(startFen.data(), startFen.size());
+		if (startFen.size() % 2 != 0)
+		{
+			m_pImpl->buffer.push_back(0);
+		}
+		for (Move move : moves)
+		{
+			std::uint16_t data = move.getData();
+			m_pImpl->write(&data, sizeof(data));
+		}
+
+		m_pImpl->offsets.push_back(m_pImpl->size);
+		m_pImpl->size += m_pImpl->buffer.size();
+		m_pImpl->file.write(reinterpret_cast<char const*>(m_pImpl->buffer.data()), m_pImpl->buffer.size());
+	}
+
+	void GameRecordWriter::finish()
+	{
+		std::ofstream& file = m_pImpl->file;
+		if (!file.is_open())
+		{
+			return;
+		}
+
+		//Keep the index eight byte aligned
+		char constexpr padding[8] = {};
+		std::size_t paddingSize = (8 - m_pImpl->size % 8) % 8;
+		file.write(padding, paddingSize);
+
+		FileHeader header = {};
+		std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+		header.version = VERSION;
+		header.gameCount = m_pImpl->offsets.size();
+		header.indexOffset = m_pImpl->size + paddingSize;
+
+		file.write(reinterpret_cast<char const*>(m_pImpl->offsets.data()), m_pImpl->offsets.size() * sizeof(std::uint64_t));
+		file.seekp(0);
+		file.write(reinterpret_cast<char const*>(&header), sizeof(header));
+		file.close();
+
+		if (file.fail())
+		{
+			throw std::runtime_error("Could not write game record file: " + m_pImpl->path);
+		}
+	}
+
+	struct GameRecordReader::Impl
+	{
+		MemoryMappedFile file;
+		std::size_t gameCount;
+		std::uint64_t indexOffset;
+
+		Impl(std::string const& path)
+			: file(path)
+		{
+			FileHeader header;
+			if (file.getSize() < HEADER_SIZE)
+			{
+				throw std::runtime_error("Invalid game record file (too small): " + path);
+			}
+			std::memcpy(&header, file.getData(), sizeof(header));
+			if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 || header.version != VERSION)
+			{
+				throw std::runtime_error("Invalid game record file (unknown format): " + path);
+			}
+			if (header.indexOffset < HEADER_SIZE || header.indexOffset > file.getSize()
+				|| (file.getSize() - header.indexOffset) != header.gameCount * sizeof(std::uint64_t))
+			{
+				throw std::runtime_error("Invalid game record file (wrong size): " + path);
+			}
+
+			gameCount = static_cast<std::size_t>(header.gameCount);
+			indexOffset = header.indexOffset;
+		}
+	};
+
+	GameRecordReader::GameRecordReader(std::string const& path)
+		: m_pImpl(std::make_unique<Impl>(path))
+	{}
+
+	GameRecordReader::~GameRecordReader() = default;
+
+	std::size_t GameRecordReader::getGameCount() const
+	{
+		return m_pImpl->gameCount;
+	}
+
+	RecordedGame GameRecordReader::getGame(std::size_t index) const
+	{
+		if (index >= m_pImpl->gameCount)
+		{
+			throw std::out_of_range("There is no game " + std::to_string(index) + " in the game record file");
+		}
+
+		unsigned char const* pData = m_pImpl->file.getData();
+		std::uint64_t offset;
+		std::memcpy(&offset, pData + m_pImpl->indexOffset + index * sizeof(offset), sizeof(offset));
+
+		//Games lie between the header and the index, and checking this keeps a corrupt file from reading out of bounds
+		GameHeader header;
+		if (offset < HEADER_SIZE || offset + GAME_HEADER_SIZE > m_pImpl->indexOffset)
+		{
+			throw std::runtime_error("Corrupt game record file (game " + std::to_string(index) + " is out of bounds)");
+		}
+		std::memcpy(&header, pData + offset, sizeof(header));
+
+		std::uint64_t movesOffset = offset + GAME_HEADER_SIZE + header.fenLength + header.fenLength % 2;
+		if (movesOffset + std::uint64_t(header.plyCount) * sizeof(std::uint16_t) > m_pImpl->indexOffset)
+		{
+			throw std::runtime_error("Corrupt game record file (game " + std::to_string(index) + " is out of bounds)");
+		}
+
+		RecordedGame game;
+		game.startFen = std::string_view(reinterpret_cast<char const*>(pData + offset + GAME_HEADER_SIZE), header.fenLength);
+		game.result = header.result;
+		game.plyCount = header.plyCount;
+		game.pMoves = pData + movesOffset;
+		return game;
+	}
+
+	void GameRecordReader::getPosition(std::size_t index, std::uint32_t ply, Board& board) const
+	{
+		RecordedGame game = getGame(index);
+		try
+		{
+			board.setFen(game.startFen.empty() ? START_FEN : game.startFen);
+		}
+		catch (std::invalid_argument const& e)
+		{
+			throw std::runtime_error("Corrupt game record file (game " + std::to_string(index) + " has an invalid starting position): " + e.what());
+		}
+
+		ply = std::min(ply, game.plyCount);
+		for (std::uint32_t i = 0; i < ply; ++i)
+		{
+			UndoRecord undoRecord;
+			if (!board.makeMove(game.getMove(i), undoRecord))
+			{
+				throw std::runtime_error("Corrupt game record file (game " + std::to_string(index) + " moves a piece that does not exist)");
+			}
+		}
+	}
+}
+}
@@ -6,6 +6,7 @@
 #include <Chess/Model/King.h>
 #include <Chess/Model/Board.h>
 #include <Chess/Model/Position.h>
+#include <Chess/Model/Attacks.h>
 
 namespace Chess
 {
@@ -31,32 +32,31 @@ namespace Model
 		return PieceType::King;
 	}
 
-	std::vector<Position> King::getAttackingPositions(Board const& board) const
+	Bitboard King::getAttackingSquares(Board const& board) const
 	{
-		std::vector<Position> attackingPositions;
-
-		Position currentPosition = getPosition();
-
-		auto checkAndPushPosition = [isWhite = isWhite(), currentPosition, &attackingPositions, &board](Position positionToCheck)
+		Square square = toSquare(getPosition());
+		Bitboard targets = KING_ATTACKS[square] & ~board.getOccupancy(isWhite());
+
+		//King can also castle two squares towards a rook it still has the right to castle with,
+		//if nothing stands between them. Whether the king passes through check is left to the legal moves
+		Bitboard occupancy = board.getOccupancy();
+		unsigned char kingsideRight = isWhite() ? WHITE_KINGSIDE_CASTLING : BLACK_KINGSIDE_CASTLING;
+		unsigned char queensideRight = isWhite() ? WHITE_QUEENSIDE_CASTLING : BLACK_QUEENSIDE_CASTLING;
+		if (square == (isWhite() ? 4 : 60))
 		{
-			if (board.isPositionPossible(isWhite, positionToCheck))
+			Bitboard kingsidePath = toBitboard(square + 1) | toBitboard(square + 2);
+			Bitboard queensidePath = toBitboard(square - 1) | toBitboard(square - 2) | toBitboard(square - 3);
+			if ((board.getCastlingRights() & kingsideRight) && (occupancy & kingsidePath) == EMPTY_BITBOARD)
 			{
-				attackingPositions.push_back(positionToCheck);
+				targets |= toBitboard(square + 2);
 			}
-		};
-
-		checkAndPushPosition(Position(currentPosition.rank + 1, currentPosition.file + 0));
-		checkAndPushPosition(Position(currentPosition.rank + 1, currentPosition.file + 1));
-		checkAndPushPosition(Position(currentPosition.rank + 0, currentPosition.file + 1));
-		checkAndPushPosition(Position(currentPosition.rank - 1, currentPosition.file + 1));
-		checkAndPushPosition(Position(currentPosition.rank - 1, currentPosition.file + 0));
-		checkAndPushPosition(Position(currentPosition.rank - 1, currentPosition.file - 1));
-		checkAndPushPosition(Position(currentPosition.rank + 0, currentPosition.file - 1));
-		checkAndPushPosition(Position(currentPosition.rank + 1, currentPosition.file - 1));
-
-		//TODO: Can also castle under certain circumstances (ignore this for now)
+			if ((board.getCastlingRights() & queensideRight) && (occupancy & queensidePath) == EMPTY_BITBOARD)
+			{
+				targets |= toBitboard(square - 2);
+			}
+		}
 
-		return attackingPositions;
+		return targets;
 	}
 }
 }
\ No newline at end of file
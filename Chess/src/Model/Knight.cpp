@@ -6,6 +6,7 @@
 #include <Chess/Model/Knight.h>
 #include <Chess/Model/Board.h>
 #include <Chess/Model/Position.h>
+#include <Chess/Model/Attacks.h>
 
 namespace Chess
 {
@@ -31,30 +32,9 @@ namespace Model
 		return PieceType::Knight;
 	}
 
-	std::vector<Position> Knight::getAttackingPositions(Board const& board) const
+	Bitboard Knight::getAttackingSquares(Board const& board) const
 	{
-		std::vector<Position> attackingPositions;
-
-		Position currentPosition = getPosition();
-
-		auto checkAndPushPosition = [isWhite = isWhite(), currentPosition, &attackingPositions, &board](Position positionToCheck)
-		{
-			if (board.isPositionPossible(isWhite, positionToCheck))
-			{
-				attackingPositions.push_back(positionToCheck);
-			}
-		};
-
-		checkAndPushPosition(Position(currentPosition.rank + 2, currentPosition.file - 1));
-		checkAndPushPosition(Position(currentPosition.rank + 2, currentPosition.file + 1));
-		checkAndPushPosition(Position(currentPosition.rank - 2, currentPosition.file - 1));
-		checkAndPushPosition(Position(currentPosition.rank - 2, currentPosition.file + 1));
-		checkAndPushPosition(Position(currentPosition.rank + 1, currentPosition.file - 2));
-		checkAndPushPosition(Position(currentPosition.rank - 1, currentPosition.file - 2));
-		checkAndPushPosition(Position(currentPosition.rank + 1, currentPosition.file + 2));
-		checkAndPushPosition(Position(currentPosition.rank - 1, currentPosition.file + 2));
-
-		return attackingPositions;
+		return KNIGHT_ATTACKS[toSquare(getPosition())] & ~board.getOccupancy(isWhite());
 	}
 }
 }
\ No newline at end of file
@@ -0,0 +1,132 @@
+// Author:	Liam Scholte
+// Created:	10/17/2026 6:12:47 PM
+// This file contains the implementations for MemoryMappedFile
+// See MemoryMappedFile.h for documentation
+
+#include <Chess/Model/MemoryMappedFile.h>
+
+#include <stdexcept>
+
+#if defined(_WIN32)
+#define NOMINMAX
+#include <Windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace Chess
+{
+namespace Model
+{
+	struct MemoryMappedFile::Impl
+	{
+		unsigned char const* pData;
+		std::size_t size;
+
+		Impl(std::string const& path)
+			: pData(nullptr)
+			, size(0)
+		{
+			auto mappingError = [&path](char const* reason)
+			{
+				return std::runtime_error("Could not map file (" + std::string(reason) + "): " + path);
+			};
+
+#if defined(_WIN32)
+			HANDLE file = CreateFileA(path.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+			if (file == INVALID_HANDLE_VALUE)
+			{
+				throw mappingError("cannot open");
+			}
+
+			LARGE_INTEGER fileSize;
+			if (!GetFileSizeEx(file, &fileSize))
+			{
+				CloseHandle(file);
+				throw mappingError("cannot read size");
+			}
+			size = static_cast<std::size_t>(fileSize.QuadPart);
+
+			//An empty file cannot be mapped, but there is nothing to read from it anyway
+			if (size > 0)
+			{
+				HANDLE mapping = CreateFileMappingA(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+				if (mapping)
+				{
+					pData = static_cast<unsigned char const*>(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+
+					//The view keeps the mapping alive on its own
+					CloseHandle(mapping);
+				}
+			}
+			CloseHandle(file);
+#else
+			int file = open(path.c_str(), O_RDONLY);
+			if (file == -1)
+			{
+				throw mappingError("cannot open");
+			}
+
+			struct stat fileStatus;
+			if (fstat(file, &fileStatus) == -1)
+			{
+				close(file);
+				throw mappingError("cannot read size");
+			}
+			size = static_cast<std::size_t>(fileStatus.st_size);
+
+			//An empty file cannot be mapped, but there is nothing to read from it anyway
+			if (size > 0)
+			{
+				void* pMapping = mmap(nullptr, size, PROT_READ, MAP_SHARED, file, 0);
+				if (pMapping != MAP_FAILED)
+				{
+					pData = static_cast<unsigned char const*>(pMapping);
+				}
+			}
+
+			//The mapping keeps the file alive on its own
+			close(file);
+#endif
+
+			if (size > 0 && !pData)
+			{
+				throw mappingError("cannot map");
+			}
+		}
+
+		~Impl()
+		{
+			if (!pData)
+			{
+				return;
+			}
+
+#if defined(_WIN32)
+			UnmapViewOfFile(pData);
+#else
+			munmap(const_cast<unsigned char*>(pData), size);
+#endif
+		}
+	};
+
+	MemoryMappedFile::MemoryMappedFile(std::string const& path)
+		: m_pImpl(std::make_unique<Impl>(path))
+	{}
+
+	MemoryMappedFile::~MemoryMappedFile() = default;
+
+	unsigned char const* MemoryMappedFile::getData() const
+	{
+		return m_pImpl->pData;
+	}
+
+	std::size_t MemoryMappedFile::getSize() const
+	{
+		return m_pImpl->size;
+	}
+}
+}
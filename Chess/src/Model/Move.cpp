@@ -0,0 +1,51 @@
+// Author:	Liam Scholte
+// Created:	10/17/2026 10:31:40 AM
+// This file contains the implementations for Move and UndoRecord
+// See Move.h for documentation
+
+#include <Chess/Model/Move.h>
+#include <Chess/Model/Piece.h>
+#include <Chess/Model/Position.h>
+
+namespace Chess
+{
+namespace Model
+{
+	namespace
+	{
+		MoveFlag promotionFlag(PieceType promotion)
+		{
+			switch (promotion)
+			{
+			case PieceType::Knight:
+				return MoveFlag::KnightPromotion;
+			case PieceType::Bishop:
+				return MoveFlag::BishopPromotion;
+			case PieceType::Rook:
+				return MoveFlag::RookPromotion;
+			default:
+				return MoveFlag::QueenPromotion;
+			}
+		}
+	}
+
+	Move::Move(Position from, Position to)
+		: Move(toSquare(from), toSquare(to), MoveFlag::Quiet)
+	{}
+
+	Move::Move(Position from, Position to, PieceType promotion)
+		: Move(toSquare(from), toSquare(to), promotionFlag(promotion))
+	{}
+
+	PieceType Move::getPromotion() const
+	{
+		if (!isPromotion())
+		{
+			return PieceType::Queen;
+		}
+
+		PieceType constexpr promotionTypes[] = { PieceType::Knight, PieceType::Bishop, PieceType::Rook, PieceType::Queen };
+		return promotionTypes[static_cast<unsigned int>(getFlag()) & 0x3];
+	}
+}
+}
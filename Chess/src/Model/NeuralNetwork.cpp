@@ -0,0 +1,452 @@
+// Author:	Liam Scholte
+// Created:	10/17/2026 6:40:31 PM
+// This file contains the implementations for NeuralNetwork
+// See NeuralNetwork.h for documentation
+
+#include <Chess/Model/NeuralNetwork.h>
+#include <Chess/Model/MemoryMappedFile.h>
+#include <Chess/Model/Search.h>
+
+#include <algorithm>
+#include <cstring>
+#include <stdexcept>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define CHESS_HAS_X86_KERNELS
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#endif
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#define CHESS_HAS_NEON_KERNELS
+#include <arm_neon.h>
+#endif
+
+//GCC and Clang only allow AVX2 intrinsics in functions compiled for AVX2, while MSVC allows them anywhere
+#if defined(CHESS_HAS_X86_KERNELS) && !defined(_MSC_VER)
+#define CHESS_TARGET(instructionSet) __attribute__((target(instructionSet)))
+#else
+#define CHESS_TARGET(instructionSet)
+#endif
+
+namespace Chess
+{
+namespace Model
+{
+	namespace
+	{
+		char constexpr MAGIC[4] = { 'A', 'R', 'C', 'N' };
+		std::uint32_t constexpr VERSION = 1;
+		std::size_t constexpr HEADER_SIZE = 64;
+
+		int constexpr HIDDEN_SIZE = NeuralNetwork::HIDDEN_SIZE;
+
+		//Hidden values are clipped to [0, HIDDEN_QUANTIZATION], which stands for [0, 1],
+		//and output weights are scaled by OUTPUT_QUANTIZATION. The output bias is scaled by both.
+		int constexpr HIDDEN_QUANTIZATION = 255;
+		int constexpr OUTPUT_QUANTIZATION = 64;
+
+		//Converts the output of the network, which predicts a win probability in sigmoid space, to centipawns
+		int constexpr OUTPUT_SCALE = 400;
+
+		/// <summary>
+		/// The kernels that do the arithmetic on the hidden layer, each operating on HIDDEN_SIZE values at once.
+		/// </summary>
+		struct Kernels
+		{
+			char const* pName;
+			void (*add)(std::int16_t* pValues, std::int16_t const* pWeights);
+			void (*subtract)(std::int16_t* pValues, std::int16_t const* pWeights);
+			void (*subtractAdd)(std::int16_t* pValues, std::int16_t const* pSubtractWeights, std::int16_t const* pAddWeights);
+
+			//The dot product of the clipped values with the weights
+			std::int32_t (*dotClipped)(std::int16_t const* pValues, std::int16_t const* pWeights);
+		};
+
+		void addScalar(std::int16_t* pValues, std::int16_t const* pWeights)
+		{
+			for (int i = 0; i < HIDDEN_SIZE; ++i)
+			{
+				pValues[i] = static_cast<std::int16_t>(pValues[i] + pWeights[i]);
+			}
+		}
+
+		void subtractScalar(std::int16_t* pValues, std::int16_t const* pWeights)
+		{
+			for (int i = 0; i < HIDDEN_SIZE; ++i)
+			{
+				pValues[i] = static_cast<std::int16_t>(pValues[i] - pWeights[i]);
+			}
+		}
+
+		void subtractAddScalar(std::int16_t* pValues, std::int16_t const* pSubtractWeights, std::int16_t const* pAddWeights)
+		{
+			for (int i = 0; i < HIDDEN_SIZE; ++i)
+			{
+				pValues[i] = static_cast<std::int16_t>(pValues[i] - pSubtractWeights[i] + pAddWeights[i]);
+			}
+		}
+
+		std::int32_t dotClippedScalar(std::int16_t const* pValues, std::int16_t const* pWeights)
+		{
+			std::int32_t sum = 0;
+			for (int i = 0; i < HIDDEN_SIZE; ++i)
+			{
+				int value = pValues[i] < 0 ? 0 : (pValues[i] > HIDDEN_QUANTIZATION ? HIDDEN_QUANTIZATION : pValues[i]);
+				sum += value * pWeights[i];
+			}
+			return sum;
+		}
+
+#if defined(CHESS_HAS_X86_KERNELS)
+		CHESS_TARGET("sse2") void addSse2(std::int16_t* pValues, std::int16_t const* pWeights)
+		{
+			for (int i = 0; i < HIDDEN_SIZE; i += 8)
+			{
+				__m128i* pChunk = reinterpret_cast<__m128i*>(pValues + i);
+				__m128i weights = _mm_loadu_si128(reinterpret_cast<__m128i const*>(pWeights + i));
+				_mm_store_si128(pChunk, _mm_add_epi16(_mm_load_si128(pChunk), weights));
+			}
+		}
+
+		CHESS_TARGET("sse2") void subtractSse2(std::int16_t* pValues, std::int16_t const* pWeights)
+		{
+			for (int i = 0; i < HIDDEN_SIZE; i += 8)
+			{
+				__m128i* pChunk = reinterpret_cast<__m128i*>(pValues + i);
+				__m128i weights = _mm_loadu_si128(reinterpret_cast<__m128i const*>(pWeights + i));
+				_mm_store_si128(pChunk, _mm_sub_epi16(_mm_load_si128(pChunk), weights));
+			}
+		}
+
+		CHESS_TARGET("sse2") void subtractAddSse2(std::int16_t* pValues, std::int16_t const* pSubtractWeights, std::int16_t const* pAddWeights)
+		{
+			for (int i = 0; i < HIDDEN_SIZE; i += 8)
+			{
+				__m128i* pChunk = reinterpret_cast<__m128i*>(pValues + i);
+				__m128i subtractWeights = _mm_loadu_si128(reinterpret_cast<__m128i const*>(pSubtractWeights + i));
+				__m128i addWeights = _mm_loadu_si128(reinterpret_cast<__m128i const*>(pAddWeights + i));
+				_mm_store_si128(pChunk, _mm_add_epi16(_mm_sub_epi16(_mm_load_si128(pChunk), subtractWeights), addWeights));
+			}
+		}
+
+		CHESS_TARGET("sse2") std::int32_t dotClippedSse2(std::int16_t const* pValues, std::int16_t const* pWeights)
+		{
+			__m128i zero = _mm_setzero_si128();
+			__m128i ceiling = _mm_set1_epi16(HIDDEN_QUANTIZATION);
+			__m128i sums = _mm_setzero_si128();
+			for (int i = 0; i < HIDDEN_SIZE; i += 8)
+			{
+				__m128i values = _mm_load_si128(reinterpret_cast<__m128i const*>(pValues + i));
+				values = _mm_min_epi16(_mm_max_epi16(values, zero), ceiling);
+				__m128i weights = _mm_loadu_si128(reinterpret_cast<__m128i const*>(pWeights + i));
+				sums = _mm_add_epi32(sums, _mm_madd_epi16(values, weights));
+			}
+			sums = _mm_add_epi32(sums, _mm_shuffle_epi32(sums, _MM_SHUFFLE(1, 0, 3, 2)));
+			sums = _mm_add_epi32(sums, _mm_shuffle_epi32(sums, _MM_SHUFFLE(2, 3, 0, 1)));
+			return _mm_cvtsi128_si32(sums);
+		}
+
+		CHESS_TARGET("avx2") void addAvx2(std::int16_t* pValues, std::int16_t const* pWeights)
+		{
+			for (int i = 0; i < HIDDEN_SIZE; i += 16)
+			{
+				__m256i* pChunk = reinterpret_cast<__m256i*>(pValues + i);
+				__m256i weights = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(pWeights + i));
+				_mm256_store_si256(pChunk, _mm256_add_epi16(_mm256_load_si256(pChunk), weights));
+			}
+		}
+
+		CHESS_TARGET("avx2") void subtractAvx2(std::int16_t* pValues, std::int16_t const* pWeights)
+		{
+			for (int i = 0; i < HIDDEN_SIZE; i += 16)
+			{
+				__m256i* pChunk = reinterpret_cast<__m256i*>(pValues + i);
+				__m256i weights = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(pWeights + i));
+				_mm256_store_si256(pChunk, _mm256_sub_epi16(_mm256_load_si256(pChunk), weights));
+			}
+		}
+
+		CHESS_TARGET("avx2") void subtractAddAvx2(std::int16_t* pValues, std::int16_t const* pSubtractWeights, std::int16_t const* pAddWeights)
+		{
+			for (int i = 0; i < HIDDEN_SIZE; i += 16)
+			{
+				__m256i* pChunk = reinterpret_cast<__m256i*>(pValues + i);
+				__m256i subtractWeights = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(pSubtractWeights + i));
+				__m256i addWeights = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(pAddWeights + i));
+				_mm256_store_si256(pChunk, _mm256_add_epi16(_mm256_sub_epi16(_mm256_load_si256(pChunk), subtractWeights), addWeights));
+			}
+		}
+
+		CHESS_TARGET("avx2") std::int32_t dotClippedAvx2(std::int16_t const* pValues, std::int16_t const* pWeights)
+		{
+			__m256i zero = _mm256_setzero_si256();
+			__m256i ceiling = _mm256_set1_epi16(HIDDEN_QUANTIZATION);
+			__m256i sums = _mm256_setzero_si256();
+			for (int i = 0; i < HIDDEN_SIZE; i += 16)
+			{
+				__m256i values = _mm256_load_si256(reinterpret_cast<__m256i const*>(pValues + i));
+				values = _mm256_min_epi16(_mm256_max_epi16(values, zero), ceiling);
+				__m256i weights = _mm256_loadu_si256(reinterpret_cast<__m256i const*>(pWeights + i));
+				sums = _mm256_add_epi32(sums, _mm256_madd_epi16(values, weights));
+			}
+			__m128i halves = _mm_add_epi32(_mm256_castsi256_si128(sums), _mm256_extracti128_si256(sums, 1));
+			halves = _mm_add_epi32(halves, _mm_shuffle_epi32(halves, _MM_SHUFFLE(1, 0, 3, 2)));
+			halves = _mm_add_epi32(halves, _mm_shuffle_epi32(halves, _MM_SHUFFLE(2, 3, 0, 1)));
+			return _mm_cvtsi128_si32(halves);
+		}
+
+		/// <summary>
+		/// Determines which instruction sets the processor and operating system support.
+		/// </summary>
+		void detectInstructionSets(bool& hasSse2, bool& hasAvx2)
+		{
+#if defined(_MSC_VER)
+			int registers[4];
+			__cpuid(registers, 0);
+			int highestLeaf = registers[0];
+
+			__cpuid(registers, 1);
+			hasSse2 = (registers[3] & (1 << 26)) != 0;
+
+			//AVX2 also needs the operating system to save the wide registers on a context switch
+			bool hasOsSavedAvx = (registers[2] & (1 << 27)) && (registers[2] & (1 << 28)) && (_xgetbv(0) & 0x6) == 0x6;
+			hasAvx2 = false;
+			if (hasOsSavedAvx && highestLeaf >= 7)
+			{
+				__cpuidex(registers, 7, 0);
+				hasAvx2 = (registers[1] & (1 << 5)) != 0;
+			}
+#else
+			__builtin_cpu_init();
+			hasSse2 = __builtin_cpu_supports("sse2");
+			hasAvx2 = __builtin_cpu_supports("avx2");
+#endif
+		}
+#endif
+
+#if defined(CHESS_HAS_NEON_KERNELS)
+		void addNeon(std::int16_t* pValues, std::int16_t const* pWeights)
+		{
+			for (int i = 0; i < HIDDEN_SIZE; i += 8)
+			{
+				vst1q_s16(pValues + i, vaddq_s16(vld1q_s16(pValues + i), vld1q_s16(pWeights + i)));
+			}
+		}
+
+		void subtractNeon(std::int16_t* pValues, std::int16_t const* pWeights)
+		{
+			for (int i = 0; i < HIDDEN_SIZE; i += 8)
+			{
+				vst1q_s16(pValues + i, vsubq_s16(vld1q_s16(pValues + i), vld1q_s16(pWeights + i)));
+			}
+		}
+
+		void subtractAddNeon(std::int16_t* pValues, std::int16_t const* pSubtractWeights, std::int16_t const* pAddWeights)
+		{
+			for (int i = 0; i < HIDDEN_SIZE; i += 8)
+			{
+				int16x8_t values = vsubq_s16(vld1q_s16(pValues + i), vld1q_s16(pSubtractWeights + i));
+				vst1q_s16(pValues + i, vaddq_s16(values, vld1q_s16(pAddWeights + i)));
+			}
+		}
+
+		std::int32_t dotClippedNeon(std::int16_t const* pValues, std::int16_t const* pWeights)
+		{
+			int16x8_t zero = vdupq_n_s16(0);
+			int16x8_t ceiling = vdupq_n_s16(HIDDEN_QUANTIZATION);
+			int32x4_t sums = vdupq_n_s32(0);
+			for (int i = 0; i < HIDDEN_SIZE; i += 8)
+			{
+				int16x8_t values = vminq_s16(vmaxq_s16(vld1q_s16(pValues + i), zero), ceiling);
+				int16x8_t weights = vld1q_s16(pWeights + i);
+				sums = vmlal_s16(sums, vget_low_s16(values), vget_low_s16(weights));
+				sums = vmlal_s16(sums, vget_high_s16(values), vget_high_s16(weights));
+			}
+			return vgetq_lane_s32(sums, 0) + vgetq_lane_s32(sums, 1) + vgetq_lane_s32(sums, 2) + vgetq_lane_s32(sums, 3);
+		}
+#endif
+
+		/// <summary>
+		/// Finds the kernels the processor supports, best first and ending with the scalar kernels.
+		/// </summary>
+		std::vector<Kernels> detectKernels()
+		{
+			std::vector<Kernels> kernels;
+#if defined(CHESS_HAS_X86_KERNELS)
+			bool hasSse2, hasAvx2;
+			detectInstructionSets(hasSse2, hasAvx2);
+			if (hasAvx2)
+			{
+				kernels.push_back({ "AVX2", addAvx2, subtractAvx2, subtractAddAvx2, dotClippedAvx2 });
+			}
+			if (hasSse2)
+			{
+				kernels.push_back({ "SSE2", addSse2, subtractSse2, subtractAddSse2, dotClippedSse2 });
+			}
+#elif defined(CHESS_HAS_NEON_KERNELS)
+			//NEON is part of every 64-bit ARM processor
+			kernels.push_back({ "NEON", addNeon, subtractNeon, subtractAddNeon, dotClippedNeon });
+#endif
+			kernels.push_back({ "Scalar", addScalar, subtractScalar, subtractAddScalar, dotClippedScalar });
+			return kernels;
+		}
+
+		std::vector<Kernels> const& getSupportedKernels()
+		{
+			static std::vector<Kernels> const kernels = detectKernels();
+			return kernels;
+		}
+
+		Kernels const& getKernels()
+		{
+			return getSupportedKernels().front();
+		}
+
+		Kernels const& getKernels(std::string_view instructionSet)
+		{
+			std::vector<Kernels> const& kernels = getSupportedKernels();
+			auto found = std::find_if(kernels.begin(), kernels.end(), [instructionSet](Kernels const& candidate)
+			{
+				return instructionSet == candidate.pName;
+			});
+			if (found == kernels.end())
+			{
+				throw std::invalid_argument("Unsupported instruction set: " + std::string(instructionSet));
+			}
+			return *found;
+		}
+
+		/// <summary>
+		/// Gets the input feature of a piece from one side's perspective. Each side sees its own
+		/// pieces first and the board from its own end, so the network is shared by both colors.
+		/// </summary>
+		int getFeature(int perspective, bool isWhite, PieceType type, Square square)
+		{
+			int relativeColor = (isWhite ? 0 : 1) == perspective ? 0 : 1;
+			int relativeSquare = perspective == 0 ? square : square ^ 56;
+			return (relativeColor * 6 + static_cast<int>(type)) * SQUARE_COUNT + relativeSquare;
+		}
+	}
+
+	struct NeuralNetwork::Impl
+	{
+		MemoryMappedFile file;
+		Kernels const& kernels;
+		std::int16_t const* pFeatureWeights;
+		std::int16_t const* pHiddenBiases;
+		std::int16_t const* pOutputWeights;
+		std::int16_t outputBias;
+
+		Impl(std::string const& path, Kernels const& kernels)
+			: file(path)
+			, kernels(kernels)
+		{
+			auto invalidNetwork = [&path](char const* reason)
+			{
+				return std::runtime_error("Invalid network file (" + std::string(reason) + "): " + path);
+			};
+
+			std::size_t parameterCount = std::size_t(FEATURE_COUNT) * HIDDEN_SIZE + HIDDEN_SIZE + 2 * HIDDEN_SIZE + 1;
+			if (file.getSize() != HEADER_SIZE + parameterCount * sizeof(std::int16_t))
+			{
+				throw invalidNetwork("wrong size");
+			}
+
+			unsigned char const* pData = file.getData();
+			std::uint32_t header[3];
+			std::memcpy(header, pData + sizeof(MAGIC), sizeof(header));
+			if (std::memcmp(pData, MAGIC, sizeof(MAGIC)) != 0 || header[0] != VERSION)
+			{
+				throw invalidNetwork("unknown format");
+			}
+			if (header[1] != FEATURE_COUNT || header[2] != HIDDEN_SIZE)
+			{
+				throw invalidNetwork("wrong layer sizes");
+			}
+
+			//The mapping is page aligned and the header keeps the weights on a cache line boundary
+			pFeatureWeights = reinterpret_cast<std::int16_t const*>(pData + HEADER_SIZE);
+			pHiddenBiases = pFeatureWeights + std::size_t(FEATURE_COUNT) * HIDDEN_SIZE;
+			pOutputWeights = pHiddenBiases + HIDDEN_SIZE;
+			outputBias = pOutputWeights[2 * HIDDEN_SIZE];
+		}
+
+		std::int16_t const* getWeights(int feature) const
+		{
+			return pFeatureWeights + std::size_t(feature) * HIDDEN_SIZE;
+		}
+	};
+
+	NeuralNetwork::NeuralNetwork(std::string const& path)
+		: m_pImpl(std::make_unique<Impl>(path, getKernels()))
+	{}
+
+	NeuralNetwork::NeuralNetwork(std::string const& path, std::string_view instructionSet)
+		: m_pImpl(std::make_unique<Impl>(path, getKernels(instructionSet)))
+	{}
+
+	NeuralNetwork::~NeuralNetwork() = default;
+
+	void NeuralNetwork::reset(Accumulator& accumulator) const
+	{
+		for (std::int16_t (&values)[HIDDEN_SIZE] : accumulator.values)
+		{
+			std::memcpy(values, m_pImpl->pHiddenBiases, sizeof(values));
+		}
+	}
+
+	void NeuralNetwork::addPiece(Accumulator& accumulator, bool isWhite, PieceType type, Square square) const
+	{
+		for (int perspective = 0; perspective < 2; ++perspective)
+		{
+			m_pImpl->kernels.add(accumulator.values[perspective], m_pImpl->getWeights(getFeature(perspective, isWhite, type, square)));
+		}
+	}
+
+	void NeuralNetwork::removePiece(Accumulator& accumulator, bool isWhite, PieceType type, Square square) const
+	{
+		for (int perspective = 0; perspective < 2; ++perspective)
+		{
+			m_pImpl->kernels.subtract(accumulator.values[perspective], m_pImpl->getWeights(getFeature(perspective, isWhite, type, square)));
+		}
+	}
+
+	void NeuralNetwork::movePiece(Accumulator& accumulator, bool isWhite, PieceType type, Square from, Square to) const
+	{
+		for (int perspective = 0; perspective < 2; ++perspective)
+		{
+			m_pImpl->kernels.subtractAdd(accumulator.values[perspective],
+				m_pImpl->getWeights(getFeature(perspective, isWhite, type, from)),
+				m_pImpl->getWeights(getFeature(perspective, isWhite, type, to)));
+		}
+	}
+
+	int NeuralNetwork::evaluate(Accumulator const& accumulator, bool isWhiteMove) const
+	{
+		int us = isWhiteMove ? 0 : 1;
+		std::int64_t output = std::int64_t(m_pImpl->kernels.dotClipped(accumulator.values[us], m_pImpl->pOutputWeights))
+			+ m_pImpl->kernels.dotClipped(accumulator.values[1 - us], m_pImpl->pOutputWeights + HIDDEN_SIZE)
+			+ m_pImpl->outputBias;
+
+		//A large enough output would otherwise be taken for a mate score by the search
+		std::int64_t score = output * OUTPUT_SCALE / (HIDDEN_QUANTIZATION * OUTPUT_QUANTIZATION);
+		return static_cast<int>(std::clamp<std::int64_t>(score, -(MATE_THRESHOLD - 1), MATE_THRESHOLD - 1));
+	}
+
+	char const* NeuralNetwork::getInstructionSet()
+	{
+		return getKernels().pName;
+	}
+
+	std::vector<char const*> NeuralNetwork::getSupportedInstructionSets()
+	{
+		std::vector<char const*> names;
+		for (Kernels const& kernels : getSupportedKernels())
+		{
+			names.push_back(kernels.pName);
+		}
+		return names;
+	}
+}
+}
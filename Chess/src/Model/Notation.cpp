@@ -0,0 +1,150 @@
+// Author:	Liam Scholte
+// Created:	10/17/2026 8:04:37 PM
+// This file contains the implementations for Notation
+// See Notation.h for documentation
+
+#include <Chess/Model/Notation.h>
+#include <Chess/Model/Board.h>
+#include <Chess/Model/MoveList.h>
+#include <Chess/Model/Piece.h>
+
+namespace Chess
+{
+namespace Model
+{
+	namespace
+	{
+		/// <summary>
+		/// Reads the letter SAN uses for a piece. Pawns have no letter.
+		/// </summary>
+		bool toPieceType(char letter, PieceType& type)
+		{
+			switch (letter)
+			{
+			case 'R': type = PieceType::Rook; return true;
+			case 'N': type = PieceType::Knight; return true;
+			case 'B': type = PieceType::Bishop; return true;
+			case 'Q': type = PieceType::Queen; return true;
+			case 'K': type = PieceType::King; return true;
+			default: return false;
+			}
+		}
+
+		bool isFile(char c)
+		{
+			return c >= 'a' && c <= 'h';
+		}
+
+		bool isRank(char c)
+		{
+			return c >= '1' && c <= '8';
+		}
+
+		/// <summary>
+		/// Finds the only legal move with a particular flag, which identifies a castling move.
+		/// </summary>
+		Move findMoveWithFlag(Board const& board, MoveFlag flag)
+		{
+			for (Move move : board.generateLegalMoves())
+			{
+				if (move.getFlag() == flag)
+				{
+					return move;
+				}
+			}
+			return Move();
+		}
+	}
+
+	Move parseSan(Board const& board, std::string_view san)
+	{
+		//Check, mate and annotation suffixes say nothing about which move was played
+		while (!san.empty() && (san.back() == '+' || san.back() == '#' || san.back() == '!' || san.back() == '?'))
+		{
+			san.remove_suffix(1);
+		}
+
+		if (san == "O-O" || san == "0-0")
+		{
+			return findMoveWithFlag(board, MoveFlag::KingCastle);
+		}
+		if (san == "O-O-O" || san == "0-0-0")
+		{
+			return findMoveWithFlag(board, MoveFlag::QueenCastle);
+		}
+
+		PieceType type = PieceType::Pawn;
+		if (!san.empty() && toPieceType(san.front(), type))
+		{
+			san.remove_prefix(1);
+		}
+
+		bool isPromotion = false;
+		PieceType promotion = PieceType::Queen;
+		if (type == PieceType::Pawn && !san.empty() && toPieceType(san.back(), promotion))
+		{
+			if (promotion == PieceType::King)
+			{
+				return Move();
+			}
+			isPromotion = true;
+			san.remove_suffix(1);
+			if (!san.empty() && san.back() == '=')
+			{
+				san.remove_suffix(1);
+			}
+		}
+
+		if (san.size() < 2 || !isFile(san[san.size() - 2]) || !isRank(san.back()))
+		{
+			return Move();
+		}
+		Square to = static_cast<Square>((san.back() - '1') * 8 + (san[san.size() - 2] - 'a'));
+		san.remove_suffix(2);
+
+		if (!san.empty() && (san.back() == 'x' || san.back() == ':'))
+		{
+			san.remove_suffix(1);
+		}
+
+		//Whatever is left tells apart pieces of the same type that can reach the destination
+		int fromFile = -1, fromRank = -1;
+		if (!san.empty() && isFile(san.front()))
+		{
+			fromFile = san.front() - 'a';
+			san.remove_prefix(1);
+		}
+		if (!san.empty() && isRank(san.front()))
+		{
+			fromRank = san.front() - '1';
+			san.remove_prefix(1);
+		}
+		if (!san.empty())
+		{
+			return Move();
+		}
+
+		Bitboard pieces = board.getBitboard(board.isWhiteMove(), type);
+		Move match;
+		int matchCount = 0;
+		for (Move move : board.generateLegalMoves())
+		{
+			Square from = move.getFrom();
+			if (move.getTo() != to
+				|| (pieces & toBitboard(from)) == EMPTY_BITBOARD
+				|| (fromFile >= 0 && from % 8 != fromFile)
+				|| (fromRank >= 0 && from / 8 != fromRank)
+				|| move.isPromotion() != isPromotion
+				|| (isPromotion && move.getPromotion() != promotion))
+			{
+				continue;
+			}
+
+			match = move;
+			++matchCount;
+		}
+
+		return matchCount == 1 ? match : Move();
+	}
+}
+}
@@ -0,0 +1,66 @@
+// Author:	Liam Scholte
+// Created:	10/17/2026 7:25:58 PM
+// This file contains the implementations for PawnHashTable
+// See PawnHashTable.h for documentation
+
+#include <Chess/Model/PawnHashTable.h>
+
+namespace Chess
+{
+namespace Model
+{
+	namespace
+	{
+		struct Entry
+		{
+			std::uint64_t pawnHash;
+			PawnEvaluation evaluation;
+		};
+	}
+
+	struct PawnHashTable::Impl
+	{
+		std::unique_ptr<Entry[]> entries;
+		std::size_t entryMask;
+
+		Impl(std::size_t sizeInKilobytes)
+		{
+			std::size_t entryCount = 1;
+			while (entryCount * 2 * sizeof(Entry) <= sizeInKilobytes * 1024)
+			{
+				entryCount *= 2;
+			}
+
+			//A position without pawns hashes to 0 and its structure evaluates to all zeroes,
+			//so a zeroed entry is already correct for it and every other entry is a miss
+			entries = std::make_unique<Entry[]>(entryCount);
+			entryMask = entryCount - 1;
+		}
+	};
+
+	PawnHashTable::PawnHashTable(std::size_t sizeInKilobytes)
+		: m_pImpl(std::make_unique<Impl>(sizeInKilobytes))
+	{}
+
+	PawnHashTable::~PawnHashTable() = default;
+
+	void PawnHashTable::clear()
+	{
+		for (std::size_t i = 0; i <= m_pImpl->entryMask; ++i)
+		{
+			m_pImpl->entries[i] = Entry();
+		}
+	}
+
+	PawnEvaluation const& PawnHashTable::probe(std::uint64_t pawnHash, Bitboard whitePawns, Bitboard blackPawns)
+	{
+		Entry& entry = m_pImpl->entries[pawnHash & m_pImpl->entryMask];
+		if (entry.pawnHash != pawnHash)
+		{
+			entry.pawnHash = pawnHash;
+			entry.evaluation = evaluatePawnStructure(whitePawns, blackPawns);
+		}
+		return entry.evaluation;
+	}
+}
+}
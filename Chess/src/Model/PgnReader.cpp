@@ -0,0 +1,276 @@
+// Author:	Liam Scholte
+// Created:	10/17/2026 8:21:12 PM
+// This file contains the implementations for PgnGame and PgnReader
+// See PgnReader.h for documentation
+
+#include <Chess/Model/PgnReader.h>
+
+#include <algorithm>
+
+namespace Chess
+{
+namespace Model
+{
+	namespace
+	{
+		bool isWhitespace(char c)
+		{
+			return c == ' ' || c == '\t' || c == '\r' || c == '\n' || c == '\f' || c == '\v';
+		}
+
+		bool isDigit(char c)
+		{
+			return c >= '0' && c <= '9';
+		}
+
+		/// <summary>
+		/// Finds the start of the line after the one containing an offset.
+		/// </summary>
+		std::size_t nextLine(std::string_view text, std::size_t offset)
+		{
+			std::size_t end = text.find('\n', offset);
+			return end == std::string_view::npos ? text.size() : end + 1;
+		}
+
+		bool isBlankLine(std::string_view text, std::size_t offset)
+		{
+			for (; offset < text.size() && text[offset] != '\n'; ++offset)
+			{
+				if (!isWhitespace(text[offset]))
+				{
+					return false;
+				}
+			}
+			return true;
+		}
+
+		/// <summary>
+		/// Skips past a comment or variation that starts at an offset, including any nested in a variation.
+		/// </summary>
+		std::size_t skipComment(std::string_view text, std::size_t offset)
+		{
+			if (text[offset] == '{')
+			{
+				std::size_t end = text.find('}', offset);
+				return end == std::string_view::npos ? text.size() : end + 1;
+			}
+			if (text[offset] == ';')
+			{
+				return nextLine(text, offset);
+			}
+
+			int depth = 0;
+			while (offset < text.size())
+			{
+				char c = text[offset];
+				if (c == '{' || c == ';')
+				{
+					offset = skipComment(text, offset);
+					continue;
+				}
+
+				depth += c == '(' ? 1 : c == ')' ? -1 : 0;
+				++offset;
+				if (depth == 0)
+				{
+					break;
+				}
+			}
+			return offset;
+		}
+
+		/// <summary>
+		/// Finds the first line at or after an offset that begins a game, which is a line starting
+		/// with '[' that follows movetext. Blank lines are not counted as movetext.
+		/// </summary>
+		std::size_t findGameStart(std::string_view text, std::size_t offset)
+		{
+			if (offset > 0 && text[offset - 1] != '\n')
+			{
+				offset = nextLine(text, offset);
+			}
+
+			//Work out if the last line before the offset with anything on it was movetext
+			std::size_t previous = offset;
+			while (previous > 0 && isWhitespace(text[previous - 1]))
+			{
+				--previous;
+			}
+			bool isAfterMovetext = true;
+			if (previous > 0)
+			{
+				std::size_t lineStart = text.rfind('\n', previous - 1);
+				isAfterMovetext = text[lineStart == std::string_view::npos ? 0 : lineStart + 1] != '[';
+			}
+
+			for (; offset < text.size(); offset = nextLine(text, offset))
+			{
+				if (text[offset] == '[' && isAfterMovetext)
+				{
+					return offset;
+				}
+				if (!isBlankLine(text, offset))
+				{
+					isAfterMovetext = text[offset] != '[';
+				}
+			}
+			return text.size();
+		}
+	}
+
+	std::string_view PgnGame::getTag(std::string_view name) const
+	{
+		for (std::size_t offset = 0; offset < tags.size(); offset = nextLine(tags, offset))
+		{
+			//A tag pair looks like [Name "Value"]
+			std::size_t nameEnd = offset + 1 + name.size();
+			if (tags[offset] != '[' || tags.compare(offset + 1, name.size(), name) != 0
+				|| nameEnd >= tags.size() || !isWhitespace(tags[nameEnd]))
+			{
+				continue;
+			}
+
+			std::size_t valueStart = tags.find('"', nameEnd);
+			if (valueStart == std::string_view::npos)
+			{
+				return std::string_view();
+			}
+			++valueStart;
+
+			std::size_t valueEnd = valueStart;
+			while (valueEnd < tags.size() && tags[valueEnd] != '"' && tags[valueEnd] != '\n')
+			{
+				//Escaped quotes and backslashes are kept as they are written
+				valueEnd += tags[valueEnd] == '\\' ? 2 : 1;
+			}
+			return tags.substr(valueStart, std::min(valueEnd, tags.size()) - valueStart);
+		}
+		return std::string_view();
+	}
+
+	bool PgnGame::readSan(std::size_t& offset, std::string_view& san) const
+	{
+		while (offset < movetext.size())
+		{
+			char c = movetext[offset];
+			if (isWhitespace(c) || c == ')')
+			{
+				++offset;
+				continue;
+			}
+			if (c == '{' || c == ';' || c == '(')
+			{
+				offset = skipComment(movetext, offset);
+				continue;
+			}
+			if (c == '%' && (offset == 0 || movetext[offset - 1] == '\n'))
+			{
+				//An escaped line
+				offset = nextLine(movetext, offset);
+				continue;
+			}
+
+			std::size_t start = offset;
+			while (offset < movetext.size() && !isWhitespace(movetext[offset])
+				&& movetext[offset] != '{' && movetext[offset] != '(' && movetext[offset] != ')' && movetext[offset] != ';')
+			{
+				++offset;
+			}
+			std::string_view token = movetext.substr(start, offset - start);
+
+			if (token[0] == '$' || token == "*" || token == "1-0" || token == "0-1" || token == "1/2-1/2")
+			{
+				//Numeric annotation glyphs and the result are not moves
+				continue;
+			}
+
+			//A move number may be written right up against the move, as in "1.e4" or "12...Nf6".
+			//Castling written with zeros also starts with a digit, but is not followed by a dot
+			std::size_t digits = 0;
+			while (digits < token.size() && isDigit(token[digits]))
+			{
+				++digits;
+			}
+			if (digits > 0 && digits < token.size() && token[digits] == '.')
+			{
+				token.remove_prefix(digits);
+				while (!token.empty() && token.front() == '.')
+				{
+					token.remove_prefix(1);
+				}
+			}
+			else if (digits == token.size())
+			{
+				continue;
+			}
+
+			if (!token.empty())
+			{
+				san = token;
+				return true;
+			}
+		}
+		return false;
+	}
+
+	PgnReader::PgnReader(std::string_view text)
+		: m_text(text)
+		, m_offset(0)
+	{
+	}
+
+	bool PgnReader::readGame(PgnGame& game)
+	{
+		while (m_offset < m_text.size() && isWhitespace(m_text[m_offset]))
+		{
+			++m_offset;
+		}
+		if (m_offset >= m_text.size())
+		{
+			return false;
+		}
+
+		std::size_t tagsStart = m_offset;
+		std::size_t tagsEnd = m_offset;
+		while (m_offset < m_text.size() && (m_text[m_offset] == '[' || isBlankLine(m_text, m_offset)))
+		{
+			bool isTag = m_text[m_offset] == '[';
+			m_offset = nextLine(m_text, m_offset);
+			if (isTag)
+			{
+				tagsEnd = m_offset;
+			}
+		}
+
+		std::size_t movetextStart = m_offset;
+		while (m_offset < m_text.size() && m_text[m_offset] != '[')
+		{
+			m_offset = nextLine(m_text, m_offset);
+		}
+
+		game.tags = m_text.substr(tagsStart, tagsEnd - tagsStart);
+		game.movetext = m_text.substr(movetextStart, m_offset - movetextStart);
+		return true;
+	}
+
+	std::vector<std::string_view> PgnReader::splitIntoChunks(std::string_view text, std::size_t chunkCount)
+	{
+		chunkCount = std::max<std::size_t>(chunkCount, 1);
+
+		std::vector<std::string_view> chunks;
+		std::size_t start = 0;
+		for (std::size_t i = 1; i <= chunkCount && start < text.size(); ++i)
+		{
+			std::size_t end = i == chunkCount
+				? text.size()
+				: findGameStart(text, std::max(start, text.size() / chunkCount * i));
+			if (end > start)
+			{
+				chunks.push_back(text.substr(start, end - start));
+				start = end;
+			}
+		}
+		return chunks;
+	}
+}
+}
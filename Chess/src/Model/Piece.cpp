@@ -6,35 +6,15 @@
 #include <Chess/Model/Piece.h>
 #include <Chess/Model/Position.h>
 #include <Chess/Model/Board.h>
+#include <Chess/Model/Move.h>
 
 namespace Chess
 {
 namespace Model
 {
-	struct Piece::Impl
-	{
-		bool isWhite;
-		Position position;
-
-		Impl(bool isWhite, Position position)
-			: isWhite(isWhite)
-			, position(position)
-		{}
-
-		void moveWithoutChecking(Board& board, Position newPosition)
-		{
-			std::shared_ptr<Piece> pExistingPiece = board.getPiece(newPosition);
-			if (pExistingPiece)
-			{
-				board.removePiece(pExistingPiece);
-			}
-
-			position = newPosition;
-		}
-	};
-
 	Piece::Piece(bool isWhite, Position position)
-		: m_pImpl(std::make_unique<Impl>(isWhite, position))
+		: m_isWhite(isWhite)
+		, m_position(position)
 	{}
 
 	Piece::Piece(Piece const& otherPiece)
@@ -45,76 +25,41 @@ namespace Model
 
 	bool Piece::isWhite() const
 	{
-		return m_pImpl->isWhite;
+		return m_isWhite;
 	}
 
 	Position Piece::getPosition() const
 	{
-		return m_pImpl->position;
+		return m_position;
 	}
 
-	bool Piece::move(Board& board, Position newPosition)
+	bool Piece::move(Board& board, Position newPosition, PieceType promotion)
 	{
-		//TODO: Calculations would have likely already been previously calculated.
-		//I can probably eliminate this repeated calculation with some clever caching
-		std::vector<Position> legalPositions = getLegalMoves(board);
-		auto legalPositionIter = std::find_if(
-			legalPositions.cbegin(),
-			legalPositions.cend(),
-			[newPosition](Position position)
-			{
-				return position == newPosition;
-			});
-		if (legalPositionIter == legalPositions.cend())
+		//Make the generated move rather than one built from the positions,
+		//so that it carries the capture, castling, en passant and promotion flags
+		Square to = toSquare(newPosition);
+		for (Move move : getLegalMoves(board))
 		{
-			//Position is not legal for this piece
-			return false;
+			if (move.getTo() == to && (!move.isPromotion() || move.getPromotion() == promotion))
+			{
+				UndoRecord undoRecord;
+				return board.makeMove(move, undoRecord);
+			}
 		}
 
-		m_pImpl->moveWithoutChecking(board, newPosition);
-		return true;
+		//Position is not legal for this piece
+		return false;
 	}
 
 	bool Piece::isUnderAttack(Board const& board) const
 	{
-		for (std::shared_ptr<Piece> pOppositeColorPiece : board.getPieces(!isWhite()))
-		{
-			std::vector<Position> attackingPositions = pOppositeColorPiece->getAttackingPositions(board);
-			auto iter = std::find_if(
-				attackingPositions.cbegin(),
-				attackingPositions.cend(),
-				[currentPosition = getPosition()](Position position)
-			{
-				return position == currentPosition;
-			});
-			
-			if (iter != attackingPositions.cend())
-			{
-				//This piece sits in a square that is threatened by an opposing piece
-				return true;
-			}
-		}
-		return false;
+		//This piece sits in a square that is threatened by an opposing piece
+		return board.isSquareAttacked(toSquare(getPosition()), !isWhite());
 	}
 
-	std::vector<Position> Piece::getLegalMoves(Board const& board) const
+	MoveList Piece::getLegalMoves(Board const& board) const
 	{
-		std::vector<Position> legalPositions;
-		for (Position position : getAttackingPositions(board))
-		{
-			//On a separate copy of the board, try moving the piece
-			//and then check if it puts the player's own King in check.
-			//Use a copied board to avoid corrupting the state of the game.
-			Board copiedBoard(board);
-			std::shared_ptr<Piece> pCopiedPiece = copiedBoard.getPiece(getPosition());
-			pCopiedPiece->m_pImpl->moveWithoutChecking(copiedBoard, position);
-			if (!copiedBoard.isKingInCheck(isWhite()))
-			{
-				legalPositions.push_back(position);
-			}
-		}
-
-		return legalPositions;
+		return board.generateLegalMoves(getPosition());
 	}
 }
 }
@@ -3,8 +3,6 @@
 // This file contains the implementations for Position
 // See Position.h for documentation
 
-#pragma once
-
 #include <Chess/Model/Position.h>
 
 namespace Chess
@@ -6,6 +6,7 @@
 #include <Chess/Model/Queen.h>
 #include <Chess/Model/Board.h>
 #include <Chess/Model/Position.h>
+#include <Chess/Model/Attacks.h>
 
 namespace Chess
 {
@@ -31,105 +32,10 @@ namespace Model
 		return PieceType::Queen;
 	}
 
-	std::vector<Position> Queen::getAttackingPositions(Board const& board) const
+	Bitboard Queen::getAttackingSquares(Board const& board) const
 	{
-		std::vector<Position> attackingPositions;
-
-		Position currentPosition = getPosition();
-
-		auto checkAndPushPosition = [isWhite = isWhite(), currentPosition, &attackingPositions, &board](Position positionToCheck)
-		{
-			if (board.isPositionPossible(isWhite, positionToCheck))
-			{
-				attackingPositions.push_back(positionToCheck);
-			}
-		};
-
-		//Go up rank
-		{
-			Position positionToCheck = currentPosition;
-			do
-			{
-				positionToCheck.rank += 1;
-				checkAndPushPosition(positionToCheck);
-			} while (!board.getPiece(positionToCheck) && board.isPositionOnBoard(positionToCheck));
-		}
-
-		//Go down rank
-		{
-			Position positionToCheck = currentPosition;
-			do
-			{
-				positionToCheck.rank -= 1;
-				checkAndPushPosition(positionToCheck);
-			} while (!board.getPiece(positionToCheck) && board.isPositionOnBoard(positionToCheck));
-		}
-
-		//Go up file
-		{
-			Position positionToCheck = currentPosition;
-			do
-			{
-				positionToCheck.file += 1;
-				checkAndPushPosition(positionToCheck);
-			} while (!board.getPiece(positionToCheck) && board.isPositionOnBoard(positionToCheck));
-		}
-
-		//Go down file
-		{
-			Position positionToCheck = currentPosition;
-			do
-			{
-				positionToCheck.file -= 1;
-				checkAndPushPosition(positionToCheck);
-			} while (!board.getPiece(positionToCheck) && board.isPositionOnBoard(positionToCheck));
-		}
-
-		//Go up rank and up file
-		{
-			Position positionToCheck = currentPosition;
-			do
-			{
-				positionToCheck.rank += 1;
-				positionToCheck.file += 1;
-				checkAndPushPosition(positionToCheck);
-			} while (!board.getPiece(positionToCheck) && board.isPositionOnBoard(positionToCheck));
-		}
-
-		//Go down rank and up file
-		{
-			Position positionToCheck = currentPosition;
-			do
-			{
-				positionToCheck.rank -= 1;
-				positionToCheck.file += 1;
-				checkAndPushPosition(positionToCheck);
-			} while (!board.getPiece(positionToCheck) && board.isPositionOnBoard(positionToCheck));
-		}
-
-		//Go up rank and down file
-		{
-			Position positionToCheck = currentPosition;
-			do
-			{
-				positionToCheck.rank += 1;
-				positionToCheck.file -= 1;
-				checkAndPushPosition(positionToCheck);
-			} while (!board.getPiece(positionToCheck) && board.isPositionOnBoard(positionToCheck));
-		}
-
-		//Go down rank and down file
-		{
-			Position positionToCheck = currentPosition;
-			do
-			{
-				positionToCheck.rank -= 1;
-				positionToCheck.file -= 1;
-				checkAndPushPosition(positionToCheck);
-			} while (!board.getPiece(positionToCheck) && board.isPositionOnBoard(positionToCheck));
-		}
-
-		return attackingPositions;
+		Bitboard attacks = getQueenAttacks(toSquare(getPosition()), board.getOccupancy());
+		return attacks & ~board.getOccupancy(isWhite());
 	}
 }
 }
\ No newline at end of file
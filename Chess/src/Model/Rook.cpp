@@ -6,6 +6,7 @@
 #include <Chess/Model/Rook.h>
 #include <Chess/Model/Board.h>
 #include <Chess/Model/Position.h>
+#include <Chess/Model/Attacks.h>
 
 namespace Chess
 {
@@ -31,61 +32,10 @@ namespace Model
 		return PieceType::Rook;
 	}
 
-	std::vector<Position> Rook::getAttackingPositions(Board const& board) const
+	Bitboard Rook::getAttackingSquares(Board const& board) const
 	{
-		std::vector<Position> attackingPositions;
-
-		Position currentPosition = getPosition();
-
-		auto checkAndPushPosition = [isWhite = isWhite(), currentPosition, &attackingPositions, &board](Position positionToCheck)
-		{
-			if (board.isPositionPossible(isWhite, positionToCheck))
-			{
-				attackingPositions.push_back(positionToCheck);
-			}
-		};
-
-		//Go up rank
-		{
-			Position positionToCheck = currentPosition;
-			do
-			{
-				positionToCheck.rank += 1;
-				checkAndPushPosition(positionToCheck);
-			} while (!board.getPiece(positionToCheck) && board.isPositionOnBoard(positionToCheck));
-		}
-
-		//Go down rank
-		{
-			Position positionToCheck = currentPosition;
-			do
-			{
-				positionToCheck.rank -= 1;
-				checkAndPushPosition(positionToCheck);
-			} while (!board.getPiece(positionToCheck) && board.isPositionOnBoard(positionToCheck));
-		}
-
-		//Go up file
-		{
-			Position positionToCheck = currentPosition;
-			do
-			{
-				positionToCheck.file += 1;
-				checkAndPushPosition(positionToCheck);
-			} while (!board.getPiece(positionToCheck) && board.isPositionOnBoard(positionToCheck));
-		}
-
-		//Go down file
-		{
-			Position positionToCheck = currentPosition;
-			do
-			{
-				positionToCheck.file -= 1;
-				checkAndPushPosition(positionToCheck);
-			} while (!board.getPiece(positionToCheck) && board.isPositionOnBoard(positionToCheck));
-		}
-
-		return attackingPositions;
+		Bitboard attacks = getRookAttacks(toSquare(getPosition()), board.getOccupancy());
+		return attacks & ~board.getOccupancy(isWhite());
 	}
 }
 }
\ No newline at end of file
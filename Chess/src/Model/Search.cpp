@@ -0,0 +1,688 @@
+// Author:	Liam Scholte
+// Created:	10/17/2026 4:41:09 PM
+// This file contains the implementations for Search
+// See Search.h for documentation
+
+#include <Chess/Model/Search.h>
+#include <Chess/Model/Board.h>
+#include <Chess/Model/MoveList.h>
+#include <Chess/Model/PawnHashTable.h>
+#include <Chess/Model/Piece.h>
+#include <Chess/Model/PieceCode.h>
+#include <Chess/Model/PositionHistory.h>
+#include <Chess/Model/Tablebase.h>
+#include <Chess/Model/TranspositionTable.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <cstring>
+#include <thread>
+
+namespace Chess
+{
+namespace Model
+{
+	namespace
+	{
+		int constexpr INFINITE_SCORE = MATE_SCORE + 1;
+		int constexpr ASPIRATION_WINDOW = 25;
+
+		//Indexed by PieceType
+		int constexpr PIECE_VALUES[6] = { 100, 500, 320, 330, 900, 0 };
+
+		//Move ordering scores, from first to last searched
+		int constexpr TRANSPOSITION_MOVE_SCORE = 1 << 30;
+		int constexpr CAPTURE_SCORE = 1 << 29;
+		int constexpr FIRST_KILLER_SCORE = 1 << 28;
+		int constexpr SECOND_KILLER_SCORE = FIRST_KILLER_SCORE - 1;
+		int constexpr LOSING_CAPTURE_SCORE = -CAPTURE_SCORE;
+		int constexpr HISTORY_LIMIT = 1 << 20;
+
+		/// <summary>
+		/// Mate scores are stored in the transposition table relative to the position being stored
+		/// rather than the root, since the same position can be reached at different plies.
+		/// </summary>
+		int toTableScore(int score, int ply)
+		{
+			return score >= MATE_THRESHOLD ? score + ply : score <= -MATE_THRESHOLD ? score - ply : score;
+		}
+
+		int fromTableScore(int score, int ply)
+		{
+			return score >= MATE_THRESHOLD ? score - ply : score <= -MATE_THRESHOLD ? score + ply : score;
+		}
+
+		/// <summary>
+		/// Scores a tablebase result like a mate found by the search. Mates too far away
+		/// for a mate score are scored just below them, still preferring the faster ones.
+		/// </summary>
+		int toTablebaseScore(TablebaseResult const& result, int ply)
+		{
+			if (result.outcome == 0)
+			{
+				return 0;
+			}
+
+			int distance = ply + static_cast<int>(result.pliesToMate);
+			int score = distance < MAX_PLY ? MATE_SCORE - distance : MATE_THRESHOLD - 1 - distance;
+			return result.outcome > 0 ? score : -score;
+		}
+
+		/// <summary>
+		/// The state shared by every thread taking part in a search.
+		/// </summary>
+		struct SharedSearchState
+		{
+			TranspositionTable& transpositionTable;
+			std::shared_ptr<Tablebase const> pTablebase;
+
+			//The positions of the game before the root that could still repeat, oldest first
+			std::vector<std::uint64_t> previousHashes;
+			std::atomic<bool> isStopRequested;
+			std::atomic<std::uint64_t> nodes;
+			SearchLimits limits;
+			std::chrono::steady_clock::time_point startTime;
+
+			SharedSearchState(TranspositionTable& transpositionTable)
+				: transpositionTable(transpositionTable)
+				, isStopRequested(false)
+				, nodes(0)
+			{}
+		};
+
+		/// <summary>
+		/// One thread of a search. Each worker searches its own copy of the board and
+		/// has its own move ordering tables, and the workers only meet in the transposition table.
+		/// Worker 0 is the main worker, whose result is the result of the search and which decides when to stop.
+		/// </summary>
+		class SearchWorker
+		{
+		public:
+			SearchWorker(SharedSearchState& shared, int index, PawnHashTable& pawnHashTable)
+				: shared(shared)
+				, index(index)
+				, pawnHashTable(pawnHashTable)
+				, nodes(0)
+				, isStopped(false)
+				, canStop(false)
+			{}
+
+			/// <summary>
+			/// Runs iterative deepening until the maximum depth or until the search is stopped.
+			/// Helper workers start on alternating depths and perturb their quiet move order,
+			/// so that they explore different parts of the tree than the main worker and feed it through the table.
+			/// </summary>
+			SearchResult iterativeDeepening(Board const& board, int maxDepth)
+			{
+				pBoard = std::make_unique<Board>(board);
+				nodes = 0;
+				isStopped = false;
+				canStop = index != 0;
+				std::fill(&killers[0][0], &killers[0][0] + MAX_PLY * 2, Move());
+				std::memset(history, 0, sizeof(history));
+				if (index != 0)
+				{
+					perturbHistory();
+				}
+
+				SearchResult result;
+				for (int depth = 1 + index % 2; depth <= maxDepth; ++depth)
+				{
+					int score = searchWithAspirationWindow(depth, result.score);
+					if (isStopped)
+					{
+						break;
+					}
+
+					result.bestMove = principalVariations[0][0];
+					result.score = score;
+					result.depth = depth;
+					result.principalVariation.assign(principalVariations[0], principalVariations[0] + principalVariationLengths[0]);
+					canStop = true;
+
+					//A mate has been found, so searching deeper will not change the result
+					if (std::abs(score) >= MATE_THRESHOLD && MATE_SCORE - std::abs(score) <= depth)
+					{
+						break;
+					}
+
+					//The next iteration would likely take longer than all of the iterations so far
+					if (shared.limits.time.count() != 0 && std::chrono::steady_clock::now() - shared.startTime >= shared.limits.time / 2)
+					{
+						break;
+					}
+				}
+
+				result.nodes = nodes;
+				return result;
+			}
+
+		private:
+			SharedSearchState& shared;
+			int index;
+
+			//Each worker has its own pawn hash table, kept between searches
+			PawnHashTable& pawnHashTable;
+
+			std::unique_ptr<Board> pBoard;
+			std::uint64_t nodes;
+			bool isStopped;
+			bool canStop;
+
+			Move killers[MAX_PLY][2];
+			int history[2][SQUARE_COUNT][SQUARE_COUNT];
+
+			//Triangular table of principal variations, where row ply holds the best line from that ply
+			Move principalVariations[MAX_PLY][MAX_PLY];
+			int principalVariationLengths[MAX_PLY];
+
+			//Hashes of the positions along the current line, for spotting repetitions
+			std::uint64_t pathHashes[MAX_PLY + 1];
+
+			/// <summary>
+			/// Counts a node, and every so often adds the count to the shared total and checks whether to stop.
+			/// Only the main worker checks the limits, and not until it has completed depth 1.
+			/// </summary>
+			void countNode()
+			{
+				if ((++nodes & 2047) != 0)
+				{
+					return;
+				}
+
+				std::uint64_t totalNodes = shared.nodes.fetch_add(2048, std::memory_order_relaxed) + 2048;
+				if (!canStop)
+				{
+					return;
+				}
+
+				if (index == 0 &&
+					((shared.limits.nodes != 0 && totalNodes >= shared.limits.nodes) ||
+					(shared.limits.time.count() != 0 && std::chrono::steady_clock::now() - shared.startTime >= shared.limits.time)))
+				{
+					shared.isStopRequested = true;
+				}
+				isStopped = shared.isStopRequested.load(std::memory_order_relaxed);
+			}
+
+			/// <summary>
+			/// Seeds the history table of a helper worker with small pseudo-random scores.
+			/// They only break ties between quiet moves that have not caused cutoffs yet, and are the same in every run.
+			/// </summary>
+			void perturbHistory()
+			{
+				std::uint64_t state = 0x9E3779B97F4A7C15ULL * static_cast<std::uint64_t>(index);
+				for (auto& colorHistory : history)
+				{
+					for (auto& fromHistory : colorHistory)
+					{
+						for (int& toHistory : fromHistory)
+						{
+							state ^= state >> 12;
+							state ^= state << 25;
+							state ^= state >> 27;
+							toHistory = static_cast<int>((state * 2685821657736338717ULL) >> 58);
+						}
+					}
+				}
+			}
+
+			void scoreMoves(MoveList const& moves, Move transpositionMove, int ply, int (&scores)[MoveList::MAX_MOVES]) const
+			{
+				int color = pBoard->isWhiteMove() ? 0 : 1;
+				for (std::size_t i = 0; i < moves.size(); ++i)
+				{
+					Move move = moves[i];
+					if (move == transpositionMove)
+					{
+						scores[i] = TRANSPOSITION_MOVE_SCORE;
+					}
+					else if (move.isCapture() || move.isPromotion())
+					{
+						//Most valuable victim, least valuable attacker
+						//An en passant capture lands on an empty square, so its victim is known to be a pawn
+						PieceType victim = move.getFlag() == MoveFlag::EnPassantCapture ? PieceType::Pawn : pBoard->getPieceCode(move.getTo()).getType();
+						int victimValue = move.isCapture() ? PIECE_VALUES[static_cast<int>(victim)] : 0;
+						int promotionValue = move.isPromotion() ? PIECE_VALUES[static_cast<int>(move.getPromotion())] : 0;
+						int attackerValue = PIECE_VALUES[static_cast<int>(pBoard->getPieceCode(move.getFrom()).getType())];
+
+						//Only a capture by a more valuable piece can lose material, and those are searched after the quiet moves
+						bool isLosing = attackerValue > victimValue + promotionValue && pBoard->see(move) < 0;
+						scores[i] = (isLosing ? LOSING_CAPTURE_SCORE : CAPTURE_SCORE) + (victimValue + promotionValue) * 16 - attackerValue / 16;
+					}
+					else if (move == killers[ply][0])
+					{
+						scores[i] = FIRST_KILLER_SCORE;
+					}
+					else if (move == killers[ply][1])
+					{
+						scores[i] = SECOND_KILLER_SCORE;
+					}
+					else
+					{
+						scores[i] = history[color][move.getFrom()][move.getTo()];
+					}
+				}
+			}
+
+			/// <summary>
+			/// Moves the best scoring of the remaining moves to the front of the remaining moves.
+			/// Sorting lazily avoids ordering moves that are never searched after a cutoff.
+			/// </summary>
+			static Move pickNextMove(MoveList& moves, int (&scores)[MoveList::MAX_MOVES], std::size_t index)
+			{
+				std::size_t best = index;
+				for (std::size_t i = index + 1; i < moves.size(); ++i)
+				{
+					if (scores[i] > scores[best])
+					{
+						best = i;
+					}
+				}
+				std::swap(moves[index], moves[best]);
+				std::swap(scores[index], scores[best]);
+				return moves[index];
+			}
+
+			void updatePrincipalVariation(int ply, Move move)
+			{
+				principalVariations[ply][ply] = move;
+				for (int i = ply + 1; i < principalVariationLengths[ply + 1]; ++i)
+				{
+					principalVariations[ply][i] = principalVariations[ply + 1][i];
+				}
+				principalVariationLengths[ply] = std::max(ply + 1, principalVariationLengths[ply + 1]);
+			}
+
+			void rewardQuietMove(Move move, int depth, int ply)
+			{
+				if (killers[ply][0] != move)
+				{
+					killers[ply][1] = killers[ply][0];
+					killers[ply][0] = move;
+				}
+
+				int& score = history[pBoard->isWhiteMove() ? 0 : 1][move.getFrom()][move.getTo()];
+				score += depth * depth;
+				if (score >= HISTORY_LIMIT)
+				{
+					//Halve every score so recent cutoffs keep counting for more than old ones
+					for (auto& colorHistory : history)
+					{
+						for (auto& fromHistory : colorHistory)
+						{
+							for (int& toHistory : fromHistory)
+							{
+								toHistory /= 2;
+							}
+						}
+					}
+				}
+			}
+
+			bool isRepetition(int ply) const
+			{
+				//Only positions since the last capture or pawn move can repeat, and the search path continues into the game
+				int reversiblePlies = static_cast<int>(pBoard->getHalfmoveClock());
+				int previousCount = static_cast<int>(shared.previousHashes.size());
+				for (int distance = 2; distance <= reversiblePlies && distance <= ply + previousCount; distance += 2)
+				{
+					int i = ply - distance;
+					if ((i >= 0 ? pathHashes[i] : shared.previousHashes[previousCount + i]) == pathHashes[ply])
+					{
+						return true;
+					}
+				}
+				return false;
+			}
+
+			int quiescence(int alpha, int beta, int ply)
+			{
+				countNode();
+				principalVariationLengths[ply] = ply;
+				if (isStopped)
+				{
+					return 0;
+				}
+				if (ply >= MAX_PLY - 1)
+				{
+					return pBoard->evaluate(pawnHashTable);
+				}
+
+				//In check every evasion is searched, since standing pat is not an option
+				bool isInCheck = pBoard->isKingInCheck(pBoard->isWhiteMove());
+				int bestScore = -INFINITE_SCORE;
+				if (!isInCheck)
+				{
+					bestScore = pBoard->evaluate(pawnHashTable);
+					if (bestScore >= beta)
+					{
+						return bestScore;
+					}
+					alpha = std::max(alpha, bestScore);
+				}
+
+				MoveList moves = isInCheck ? pBoard->generateLegalMoves() : pBoard->generateLegalCaptures();
+				if (isInCheck && moves.empty())
+				{
+					return -MATE_SCORE + ply;
+				}
+
+				int scores[MoveList::MAX_MOVES];
+				scoreMoves(moves, Move(), ply, scores);
+				for (std::size_t i = 0; i < moves.size(); ++i)
+				{
+					Move move = pickNextMove(moves, scores, i);
+
+					//Captures that lose material are very unlikely to raise the stand pat score
+					if (!isInCheck && scores[i] < 0)
+					{
+						break;
+					}
+
+					UndoRecord undoRecord;
+					pBoard->makeMove(move, undoRecord);
+					int score = -quiescence(-beta, -alpha, ply + 1);
+					pBoard->unmakeMove(move, undoRecord);
+
+					if (isStopped)
+					{
+						return 0;
+					}
+					if (score > bestScore)
+					{
+						bestScore = score;
+						if (score > alpha)
+						{
+							alpha = score;
+							if (score >= beta)
+							{
+								break;
+							}
+						}
+					}
+				}
+				return bestScore;
+			}
+
+			int negamax(int depth, int alpha, int beta, int ply)
+			{
+				principalVariationLengths[ply] = ply;
+				pathHashes[ply] = pBoard->getHash();
+				if (ply > 0 && (isStopped || isRepetition(ply) || pBoard->getHalfmoveClock() >= PositionHistory::FIFTY_MOVE_PLIES))
+				{
+					return 0;
+				}
+				if (ply >= MAX_PLY - 1)
+				{
+					return pBoard->evaluate(pawnHashTable);
+				}
+
+				TablebaseResult tablebaseResult;
+				if (ply > 0 && shared.pTablebase && popCount(pBoard->getOccupancy()) <= shared.pTablebase->getMaxPieceCount()
+					&& shared.pTablebase->probe(*pBoard, tablebaseResult))
+				{
+					countNode();
+					return toTablebaseScore(tablebaseResult, ply);
+				}
+
+				bool isInCheck = pBoard->isKingInCheck(pBoard->isWhiteMove());
+				if (isInCheck)
+				{
+					//Extend checks so forcing lines are not cut off at the horizon
+					++depth;
+				}
+				if (depth <= 0)
+				{
+					return quiescence(alpha, beta, ply);
+				}
+				countNode();
+
+				bool isPrincipalVariationNode = beta - alpha > 1;
+				TranspositionEntry entry;
+				Move transpositionMove;
+				if (shared.transpositionTable.probe(pBoard->getHash(), entry))
+				{
+					transpositionMove = entry.move;
+					int score = fromTableScore(entry.score, ply);
+					if (ply > 0 && !isPrincipalVariationNode && entry.depth >= depth &&
+						(entry.bound == Bound::Exact ||
+						(entry.bound == Bound::Lower && score >= beta) ||
+						(entry.bound == Bound::Upper && score <= alpha)))
+					{
+						return score;
+					}
+				}
+
+				MoveList moves = pBoard->generateLegalMoves();
+				if (moves.empty())
+				{
+					return isInCheck ? -MATE_SCORE + ply : 0;
+				}
+
+				int scores[MoveList::MAX_MOVES];
+				scoreMoves(moves, transpositionMove, ply, scores);
+
+				int originalAlpha = alpha;
+				int bestScore = -INFINITE_SCORE;
+				Move bestMove;
+				for (std::size_t i = 0; i < moves.size(); ++i)
+				{
+					Move move = pickNextMove(moves, scores, i);
+
+					UndoRecord undoRecord;
+					pBoard->makeMove(move, undoRecord);
+
+					//The child probes the table before searching its moves, so start loading its bucket now
+					shared.transpositionTable.prefetch(pBoard->getHash());
+
+					//Principal variation search: after the first move, prove each move is worse with a null window
+					//and only search it again with the full window if that fails
+					int score;
+					if (i == 0)
+					{
+						score = -negamax(depth - 1, -beta, -alpha, ply + 1);
+					}
+					else
+					{
+						score = -negamax(depth - 1, -alpha - 1, -alpha, ply + 1);
+						if (score > alpha && score < beta)
+						{
+							score = -negamax(depth - 1, -beta, -alpha, ply + 1);
+						}
+					}
+
+					pBoard->unmakeMove(move, undoRecord);
+
+					if (isStopped)
+					{
+						return 0;
+					}
+					if (score > bestScore)
+					{
+						bestScore = score;
+						bestMove = move;
+						if (score > alpha)
+						{
+							alpha = score;
+							updatePrincipalVariation(ply, move);
+							if (score >= beta)
+							{
+								if (!move.isCapture() && !move.isPromotion())
+								{
+									rewardQuietMove(move, depth, ply);
+								}
+								break;
+							}
+						}
+					}
+				}
+
+				Bound bound = bestScore >= beta ? Bound::Lower : bestScore > originalAlpha ? Bound::Exact : Bound::Upper;
+				shared.transpositionTable.store(pBoard->getHash(), bestMove, toTableScore(bestScore, ply), depth, bound);
+				return bestScore;
+			}
+
+			/// <summary>
+			/// Searches the root to a depth, starting with a narrow window around the previous score
+			/// and widening it on whichever side the score falls outside of.
+			/// </summary>
+			int searchWithAspirationWindow(int depth, int previousScore)
+			{
+				int window = ASPIRATION_WINDOW;
+				int alpha = -INFINITE_SCORE;
+				int beta = INFINITE_SCORE;
+				if (depth >= 4)
+				{
+					alpha = std::max(previousScore - window, -INFINITE_SCORE);
+					beta = std::min(previousScore + window, INFINITE_SCORE);
+				}
+
+				while (true)
+				{
+					int score = negamax(depth, alpha, beta, 0);
+					if (isStopped)
+					{
+						return score;
+					}
+
+					if (score <= alpha)
+					{
+						alpha = std::max(score - window, -INFINITE_SCORE);
+					}
+					else if (score >= beta)
+					{
+						beta = std::min(score + window, INFINITE_SCORE);
+					}
+					else
+					{
+						return score;
+					}
+					window *= 2;
+				}
+			}
+		};
+	}
+
+	struct Search::Impl
+	{
+		SharedSearchState shared;
+		unsigned int threadCount;
+
+		//One pawn hash table per thread, so that no locking is needed to use them
+		std::vector<std::unique_ptr<PawnHashTable>> pawnHashTables;
+
+		Impl(TranspositionTable& transpositionTable, unsigned int threadCount)
+			: shared(transpositionTable)
+			, threadCount(std::max(1u, threadCount))
+		{}
+	};
+
+	Search::Search(TranspositionTable& transpositionTable, unsigned int threadCount)
+		: m_pImpl(std::make_unique<Impl>(transpositionTable, threadCount))
+	{}
+
+	Search::~Search() = default;
+
+	void Search::setThreadCount(unsigned int threadCount)
+	{
+		m_pImpl->threadCount = std::max(1u, threadCount);
+	}
+
+	unsigned int Search::getThreadCount() const
+	{
+		return m_pImpl->threadCount;
+	}
+
+	void Search::setTablebase(std::shared_ptr<Tablebase const> pTablebase)
+	{
+		m_pImpl->shared.pTablebase = std::move(pTablebase);
+	}
+
+	SearchResult Search::search(Board const& board, SearchLimits const& limits)
+	{
+		return search(board, limits, PositionHistory());
+	}
+
+	SearchResult Search::search(Board const& board, SearchLimits const& limits, PositionHistory const& history)
+	{
+		SharedSearchState& shared = m_pImpl->shared;
+		shared.previousHashes.clear();
+		if (!history.empty() && history.getHash(history.size() - 1) == board.getHash())
+		{
+			std::size_t rootIndex = history.size() - 1;
+			std::size_t previousCount = std::min<std::size_t>(rootIndex, board.getHalfmoveClock());
+			for (std::size_t i = rootIndex - previousCount; i < rootIndex; ++i)
+			{
+				shared.previousHashes.push_back(history.getHash(i));
+			}
+		}
+
+		shared.limits = limits;
+		shared.startTime = std::chrono::steady_clock::now();
+		shared.nodes = 0;
+		shared.transpositionTable.newSearch();
+
+		//A stop asked for before the search started is answered by this search rather than lost
+		bool isStopPending = shared.isStopRequested.exchange(false);
+
+		MoveList moves = board.generateLegalMoves();
+		if (moves.empty())
+		{
+			SearchResult result;
+			result.score = board.isKingInCheck(board.isWhiteMove()) ? -MATE_SCORE : 0;
+			return result;
+		}
+
+		if (isStopPending)
+		{
+			SearchResult result;
+			result.bestMove = moves[0];
+			result.principalVariation.push_back(moves[0]);
+			return result;
+		}
+
+		int maxDepth = std::max(1, std::min(limits.depth, MAX_PLY - 1));
+
+		//The workers are large, so they live on the heap rather than on the stacks of the threads
+		std::vector<std::unique_ptr<SearchWorker>> workers;
+		std::vector<std::uint64_t> helperNodes(m_pImpl->threadCount - 1, 0);
+		std::vector<std::thread> helperThreads;
+		while (m_pImpl->pawnHashTables.size() < m_pImpl->threadCount)
+		{
+			m_pImpl->pawnHashTables.push_back(std::make_unique<PawnHashTable>());
+		}
+		for (unsigned int i = 0; i < m_pImpl->threadCount; ++i)
+		{
+			workers.push_back(std::make_unique<SearchWorker>(shared, static_cast<int>(i), *m_pImpl->pawnHashTables[i]));
+		}
+		for (unsigned int i = 1; i < m_pImpl->threadCount; ++i)
+		{
+			helperThreads.emplace_back([&workers, &helperNodes, &board, maxDepth, i]()
+			{
+				helperNodes[i - 1] = workers[i]->iterativeDeepening(board, maxDepth).nodes;
+			});
+		}
+
+		SearchResult result = workers[0]->iterativeDeepening(board, maxDepth);
+
+		//Once the main worker is done the helpers have nothing left to contribute
+		shared.isStopRequested = true;
+		for (unsigned int i = 0; i < helperThreads.size(); ++i)
+		{
+			helperThreads[i].join();
+			result.nodes += helperNodes[i];
+		}
+
+		//The search is over, so a later stop is meant for the next search
+		shared.isStopRequested = false;
+		return result;
+	}
+
+	void Search::stop()
+	{
+		m_pImpl->shared.isStopRequested = true;
+	}
+}
+}
@@ -0,0 +1,1250 @@
+// Author:	Liam Scholte
+// Created:	10/17/2026 10:14:52 PM
+// This file contains the implementations for Tablebase
+// See Tablebase.h for documentation
+
+#include <Chess/Model/Tablebase.h>
+#include <Chess/Model/Attacks.h>
+#include <Chess/Model/Board.h>
+#include <Chess/Model/MemoryMappedFile.h>
+#include <Chess/Model/MoveList.h>
+#include <Chess/Model/Piece.h>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <stdexcept>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+namespace Chess
+{
+namespace Model
+{
+	namespace
+	{
+		int constexpr MAX_PIECES = Tablebase::MAX_PIECES;
+
+		char constexpr MAGIC[4] = { 'A', 'R', 'T', 'B' };
+		std::uint32_t constexpr VERSION = 1;
+		char constexpr FILE_EXTENSION[] = ".artb";
+
+		//Positions per compressed block. Smaller blocks make probes faster and the index larger
+		std::uint32_t constexpr BLOCK_SIZE = 1024;
+
+		//A stored value of 0 is a draw (or not yet known while generating), 255 is a position that
+		//cannot occur, and anything else is the distance to mate in plies plus one. The side to move
+		//is mated when the distance is even and mates when it is odd
+		std::uint8_t constexpr DRAW = 0;
+		std::uint8_t constexpr INVALID = 255;
+		std::uint8_t constexpr MAX_STORED_VALUE = 254;
+
+		//The order of the pieces of each side after the king, strongest first
+		PieceType constexpr TABLE_ORDER[5] = { PieceType::Queen, PieceType::Rook, PieceType::Bishop, PieceType::Knight, PieceType::Pawn };
+
+		struct FileHeader
+		{
+			char magic[4];
+			std::uint32_t version;
+			std::uint32_t pieceCount;
+			std::uint32_t blockSize;
+			std::uint64_t entryCount;
+			std::uint64_t blockCount;
+			char material[16];
+			std::uint64_t reserved[2];
+		};
+		static_assert(sizeof(FileHeader) == 64, "The file header must match the file format");
+
+		char getLetter(PieceType type)
+		{
+			char constexpr letters[6] = { 'P', 'R', 'N', 'B', 'Q', 'K' };
+			return letters[static_cast<int>(type)];
+		}
+
+		/// <summary>
+		/// How many pieces of each color and type there are, indexed by color (0 = white) and then PieceType.
+		/// </summary>
+		struct Material
+		{
+			int counts[2][6] = {};
+
+			int getPieceCount() const
+			{
+				int count = 0;
+				for (int color = 0; color < 2; ++color)
+				{
+					for (int type = 0; type < 6; ++type)
+					{
+						count += counts[color][type];
+					}
+				}
+				return count;
+			}
+
+			/// <summary>
+			/// Determines if black has more (or, for the same number, stronger) pieces than white.
+			/// Tables are stored with the stronger side as white.
+			/// </summary>
+			bool isBlackStronger() const
+			{
+				int totals[2] = {};
+				for (int color = 0; color < 2; ++color)
+				{
+					for (PieceType type : TABLE_ORDER)
+					{
+						totals[color] += counts[color][static_cast<int>(type)];
+					}
+				}
+				if (totals[0] != totals[1])
+				{
+					return totals[1] > totals[0];
+				}
+				for (PieceType type : TABLE_ORDER)
+				{
+					int typeIndex = static_cast<int>(type);
+					if (counts[0][typeIndex] != counts[1][typeIndex])
+					{
+						return counts[1][typeIndex] > counts[0][typeIndex];
+					}
+				}
+				return false;
+			}
+
+			Material getFlipped() const
+			{
+				Material flipped;
+				std::memcpy(flipped.counts[0], counts[1], sizeof(counts[1]));
+				std::memcpy(flipped.counts[1], counts[0], sizeof(counts[0]));
+				return flipped;
+			}
+
+			/// <summary>
+			/// Packs the counts of the pieces other than the kings into a key, 3 bits per count.
+			/// </summary>
+			std::uint32_t getKey() const
+			{
+				std::uint32_t key = 0;
+				for (int color = 0; color < 2; ++color)
+				{
+					for (int type = 0; type < 5; ++type)
+					{
+						key |= static_cast<std::uint32_t>(counts[color][type]) << (3 * (color * 5 + type));
+					}
+				}
+				return key;
+			}
+
+			std::string getName() const
+			{
+				std::string name;
+				for (int color = 0; color < 2; ++color)
+				{
+					name += color == 0 ? "K" : "vK";
+					for (PieceType type : TABLE_ORDER)
+					{
+						name.append(counts[color][static_cast<int>(type)], getLetter(type));
+					}
+				}
+				return name;
+			}
+		};
+
+		Material parseMaterial(std::string const& name)
+		{
+			auto invalidMaterial = [&name](char const* reason)
+			{
+				return std::invalid_argument("Invalid tablebase material (" + std::string(reason) + "): " + name);
+			};
+
+			std::size_t separator = name.find('v');
+			if (separator == std::string::npos || name.empty() || name[0] != 'K' || separator + 1 >= name.size() || name[separator + 1] != 'K')
+			{
+				throw invalidMaterial("expected the form KxvKy");
+			}
+
+			Material material;
+			material.counts[0][static_cast<int>(PieceType::King)] = 1;
+			material.counts[1][static_cast<int>(PieceType::King)] = 1;
+			for (std::size_t i = 1; i < name.size(); ++i)
+			{
+				if (i == separator || i == separator + 1)
+				{
+					continue;
+				}
+
+				int color = i < separator ? 0 : 1;
+				switch (name[i])
+				{
+				case 'Q': ++material.counts[color][static_cast<int>(PieceType::Queen)]; break;
+				case 'R': ++material.counts[color][static_cast<int>(PieceType::Rook)]; break;
+				case 'B': ++material.counts[color][static_cast<int>(PieceType::Bishop)]; break;
+				case 'N': ++material.counts[color][static_cast<int>(PieceType::Knight)]; break;
+				case 'P': ++material.counts[color][static_cast<int>(PieceType::Pawn)]; break;
+				default: throw invalidMaterial("unknown piece");
+				}
+			}
+
+			if (material.getPieceCount() > MAX_PIECES)
+			{
+				throw invalidMaterial("too many pieces");
+			}
+			return material;
+		}
+
+		/// <summary>
+		/// A piece in a tablebase position.
+		/// </summary>
+		struct TablePiece
+		{
+			bool isWhite;
+			PieceType type;
+			Square square;
+		};
+
+		/// <summary>
+		/// A position as a short list of pieces. Within a table the pieces are kept in the order of the
+		/// table's layout: the white king, the black king, then the other white and black pieces in TABLE_ORDER.
+		/// </summary>
+		struct TablePosition
+		{
+			TablePiece pieces[MAX_PIECES];
+			int pieceCount;
+			bool isWhiteMove;
+
+			Bitboard getOccupancy() const
+			{
+				Bitboard occupancy = EMPTY_BITBOARD;
+				for (int i = 0; i < pieceCount; ++i)
+				{
+					occupancy |= toBitboard(pieces[i].square);
+				}
+				return occupancy;
+			}
+
+			Bitboard getOccupancy(bool isWhite) const
+			{
+				Bitboard occupancy = EMPTY_BITBOARD;
+				for (int i = 0; i < pieceCount; ++i)
+				{
+					if (pieces[i].isWhite == isWhite)
+					{
+						occupancy |= toBitboard(pieces[i].square);
+					}
+				}
+				return occupancy;
+			}
+
+			Square getKingSquare(bool isWhite) const
+			{
+				for (int i = 0; i < pieceCount; ++i)
+				{
+					if (pieces[i].isWhite == isWhite && pieces[i].type == PieceType::King)
+					{
+						return pieces[i].square;
+					}
+				}
+				return NO_SQUARE;
+			}
+
+			Material getMaterial() const
+			{
+				Material material;
+				for (int i = 0; i < pieceCount; ++i)
+				{
+					++material.counts[pieces[i].isWhite ? 0 : 1][static_cast<int>(pieces[i].type)];
+				}
+				return material;
+			}
+		};
+
+		Bitboard getAttacks(TablePiece const& piece, Bitboard occupancy)
+		{
+			switch (piece.type)
+			{
+			case PieceType::Pawn: return PAWN_ATTACKS[piece.isWhite ? 0 : 1][piece.square];
+			case PieceType::Knight: return KNIGHT_ATTACKS[piece.square];
+			case PieceType::Bishop: return getBishopAttacks(piece.square, occupancy);
+			case PieceType::Rook: return getRookAttacks(piece.square, occupancy);
+			case PieceType::Queen: return getQueenAttacks(piece.square, occupancy);
+			default: return KING_ATTACKS[piece.square];
+			}
+		}
+
+		bool isSquareAttacked(TablePosition const& position, Square square, bool byWhite)
+		{
+			Bitboard occupancy = position.getOccupancy();
+			for (int i = 0; i < position.pieceCount; ++i)
+			{
+				if (position.pieces[i].isWhite == byWhite && (getAttacks(position.pieces[i], occupancy) & toBitboard(square)) != EMPTY_BITBOARD)
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+
+		bool isInCheck(TablePosition const& position)
+		{
+			return isSquareAttacked(position, position.getKingSquare(position.isWhiteMove), !position.isWhiteMove);
+		}
+
+		/// <summary>
+		/// Determines if a decoded position can occur: no two pieces share a square,
+		/// no pawn is on the first or last rank and the side that just moved is not in check.
+		/// </summary>
+		bool isValid(TablePosition const& position)
+		{
+			Bitboard occupancy = EMPTY_BITBOARD;
+			for (int i = 0; i < position.pieceCount; ++i)
+			{
+				TablePiece const& piece = position.pieces[i];
+				if ((occupancy & toBitboard(piece.square)) != EMPTY_BITBOARD
+					|| (piece.type == PieceType::Pawn && (piece.square < 8 || piece.square >= 56)))
+				{
+					return false;
+				}
+				occupancy |= toBitboard(piece.square);
+			}
+			return !isSquareAttacked(position, position.getKingSquare(!position.isWhiteMove), position.isWhiteMove);
+		}
+
+		/// <summary>
+		/// Calls visit with the position after each legal move and whether the move keeps the same material,
+		/// which is the case unless it captures or promotes. Promotions to every piece are generated.
+		/// Stops early if visit returns false.
+		/// </summary>
+		template <typename Visit>
+		void forEachMove(TablePosition const& position, Visit&& visit)
+		{
+			bool isWhite = position.isWhiteMove;
+			Bitboard occupancy = position.getOccupancy();
+			Bitboard ownOccupancy = position.getOccupancy(isWhite);
+			Bitboard enemyOccupancy = occupancy & ~ownOccupancy;
+
+			auto tryMove = [&](int index, Square to, PieceType promotion)
+			{
+				TablePosition child = position;
+				child.isWhiteMove = !isWhite;
+				child.pieces[index].square = to;
+
+				bool isSameMaterial = promotion == PieceType::Pawn || position.pieces[index].type != PieceType::Pawn;
+				if (!isSameMaterial)
+				{
+					child.pieces[index].type = promotion;
+				}
+				if ((enemyOccupancy & toBitboard(to)) != EMPTY_BITBOARD)
+				{
+					for (int i = 0; i < child.pieceCount; ++i)
+					{
+						if (i != index && child.pieces[i].square == to)
+						{
+							std::copy(child.pieces + i + 1, child.pieces + child.pieceCount, child.pieces + i);
+							--child.pieceCount;
+							break;
+						}
+					}
+					isSameMaterial = false;
+				}
+
+				if (isSquareAttacked(child, child.getKingSquare(isWhite), !isWhite))
+				{
+					return true;
+				}
+				return visit(static_cast<TablePosition const&>(child), isSameMaterial);
+			};
+
+			for (int i = 0; i < position.pieceCount; ++i)
+			{
+				TablePiece const& piece = position.pieces[i];
+				if (piece.isWhite != isWhite)
+				{
+					continue;
+				}
+
+				Bitboard targets;
+				if (piece.type == PieceType::Pawn)
+				{
+					int forward = isWhite ? 8 : -8;
+					Square push = static_cast<Square>(piece.square + forward);
+					targets = getAttacks(piece, occupancy) & enemyOccupancy;
+					if ((occupancy & toBitboard(push)) == EMPTY_BITBOARD)
+					{
+						targets |= toBitboard(push);
+						int startRank = isWhite ? 1 : 6;
+						Square doublePush = static_cast<Square>(push + forward);
+						if (piece.square / 8 == startRank && (occupancy & toBitboard(doublePush)) == EMPTY_BITBOARD)
+						{
+							targets |= toBitboard(doublePush);
+						}
+					}
+				}
+				else
+				{
+					targets = getAttacks(piece, occupancy) & ~ownOccupancy;
+				}
+
+				while (targets != EMPTY_BITBOARD)
+				{
+					Square to = popLowestSquare(targets);
+					if (piece.type == PieceType::Pawn && (to < 8 || to >= 56))
+					{
+						for (PieceType promotion : { PieceType::Queen, PieceType::Rook, PieceType::Bishop, PieceType::Knight })
+						{
+							if (!tryMove(i, to, promotion))
+							{
+								return;
+							}
+						}
+					}
+					else if (!tryMove(i, to, PieceType::Pawn))
+					{
+						return;
+					}
+				}
+			}
+		}
+
+		/// <summary>
+		/// Squares the white king is kept on by symmetry. Without pawns the board can be mirrored
+		/// across files, ranks and the a1-h8 diagonal, which puts the king in the a1-d1-d4 triangle.
+		/// Pawns only move one way, so with pawns the board can only be mirrored across files.
+		/// </summary>
+		Square constexpr PAWNLESS_KING_SQUARES[10] = { 0, 1, 2, 3, 9, 10, 11, 18, 19, 27 };
+
+		std::array<int, SQUARE_COUNT> constexpr PAWNLESS_KING_INDICES = []()
+		{
+			std::array<int, SQUARE_COUNT> indices{};
+			for (int& index : indices)
+			{
+				index = -1;
+			}
+			for (int i = 0; i < 10; ++i)
+			{
+				indices[PAWNLESS_KING_SQUARES[i]] = i;
+			}
+			return indices;
+		}();
+
+		/// <summary>
+		/// The pieces in a table and how its positions are indexed. The index is made up of the side to move,
+		/// the square of the white king within its symmetry region and then 6 bits for the square of each other piece.
+		/// </summary>
+		struct TableLayout
+		{
+			Material material;
+			std::string name;
+			int pieceCount;
+			bool isWhite[MAX_PIECES];
+			PieceType types[MAX_PIECES];
+			bool hasPawns;
+			int kingSquareCount;
+			std::uint64_t entryCount;
+
+			explicit TableLayout(Material const& material)
+				: material(material)
+				, name(material.getName())
+				, pieceCount(0)
+			{
+				for (int color = 0; color < 2; ++color)
+				{
+					isWhite[pieceCount] = color == 0;
+					types[pieceCount++] = PieceType::King;
+				}
+				for (int color = 0; color < 2; ++color)
+				{
+					for (PieceType type : TABLE_ORDER)
+					{
+						for (int i = 0; i < material.counts[color][static_cast<int>(type)]; ++i)
+						{
+							isWhite[pieceCount] = color == 0;
+							types[pieceCount++] = type;
+						}
+					}
+				}
+
+				hasPawns = material.counts[0][static_cast<int>(PieceType::Pawn)] + material.counts[1][static_cast<int>(PieceType::Pawn)] > 0;
+				kingSquareCount = hasPawns ? 32 : 10;
+				entryCount = 2 * static_cast<std::uint64_t>(kingSquareCount) << (6 * (pieceCount - 1));
+			}
+
+			std::uint64_t encode(TablePosition const& position) const
+			{
+				//Mirror the board so that the white king lands in its region
+				Square whiteKing = position.pieces[0].square;
+				int flip = 0;
+				if (whiteKing % 8 > 3)
+				{
+					flip ^= 7;
+				}
+				if (!hasPawns && whiteKing / 8 > 3)
+				{
+					flip ^= 56;
+				}
+				Square flippedKing = static_cast<Square>(whiteKing ^ flip);
+				bool isDiagonalFlipped = !hasPawns && flippedKing / 8 > flippedKing % 8;
+
+				//A king on the diagonal is left there by mirroring across it, so the first piece off the diagonal decides
+				for (int i = 1; !hasPawns && flippedKing / 8 == flippedKing % 8 && i < pieceCount; ++i)
+				{
+					Square square = static_cast<Square>(position.pieces[i].square ^ flip);
+					if (square / 8 != square % 8)
+					{
+						isDiagonalFlipped = square / 8 > square % 8;
+						break;
+					}
+				}
+
+				auto transform = [flip, isDiagonalFlipped](Square square)
+				{
+					square = static_cast<Square>(square ^ flip);
+					return isDiagonalFlipped ? static_cast<Square>(((square & 7) << 3) | (square >> 3)) : square;
+				};
+
+				Square kingSquare = transform(whiteKing);
+				std::uint64_t index = position.isWhiteMove ? 0 : 1;
+				index = index * kingSquareCount + (hasPawns ? (kingSquare / 8) * 4 + kingSquare % 8 : PAWNLESS_KING_INDICES[kingSquare]);
+				for (int i = 1; i < pieceCount; ++i)
+				{
+					index = (index << 6) | transform(position.pieces[i].square);
+				}
+				return index;
+			}
+
+			void decode(std::uint64_t index, TablePosition& position) const
+			{
+				position.pieceCount = pieceCount;
+				for (int i = pieceCount - 1; i >= 1; --i)
+				{
+					position.pieces[i] = { isWhite[i], types[i], static_cast<Square>(index & 63) };
+					index >>= 6;
+				}
+
+				int kingIndex = static_cast<int>(index % kingSquareCount);
+				Square kingSquare = hasPawns ? static_cast<Square>((kingIndex / 4) * 8 + kingIndex % 4) : PAWNLESS_KING_SQUARES[kingIndex];
+				position.pieces[0] = { true, PieceType::King, kingSquare };
+				position.isWhiteMove = index / kingSquareCount == 0;
+			}
+
+			/// <summary>
+			/// Puts the pieces of a position with this table's material into the layout's order.
+			/// </summary>
+			void arrange(TablePosition const& position, TablePosition& arranged) const
+			{
+				arranged.pieceCount = pieceCount;
+				arranged.isWhiteMove = position.isWhiteMove;
+				bool isUsed[MAX_PIECES] = {};
+				for (int slot = 0; slot < pieceCount; ++slot)
+				{
+					for (int i = 0; i < position.pieceCount; ++i)
+					{
+						if (!isUsed[i] && position.pieces[i].isWhite == isWhite[slot] && position.pieces[i].type == types[slot])
+						{
+							arranged.pieces[slot] = position.pieces[i];
+							isUsed[i] = true;
+							break;
+						}
+					}
+				}
+			}
+		};
+
+		/// <summary>
+		/// Reads a varint written by writeVarint without reading past the end of the data.
+		/// </summary>
+		/// <returns>True if a whole varint was read, false if the data ended or the varint is too long</returns>
+		bool readVarint(unsigned char const*& pData, unsigned char const* pEnd, std::uint64_t& value)
+		{
+			value = 0;
+			for (int shift = 0; pData < pEnd && shift < 64; shift += 7)
+			{
+				value |= static_cast<std::uint64_t>(*pData & 0x7F) << shift;
+				if ((*pData++ & 0x80) == 0)
+				{
+					return true;
+				}
+			}
+			return false;
+		}
+
+		/// <summary>
+		/// A table, either held in memory while tables are generated or memory mapped for probing.
+		/// </summary>
+		struct Table
+		{
+			TableLayout layout;
+			std::vector<std::uint8_t> values;
+			std::unique_ptr<MemoryMappedFile> pFile;
+			unsigned char const* pBlockOffsets = nullptr;
+			unsigned char const* pBlocks = nullptr;
+
+			explicit Table(TableLayout const& layout)
+				: layout(layout)
+			{}
+
+			/// <summary>
+			/// Gets the value of a position, or INVALID if the runs of its block end before reaching it.
+			/// </summary>
+			std::uint8_t getValue(std::uint64_t index) const
+			{
+				if (!pFile)
+				{
+					return values[index];
+				}
+
+				//Walk the runs of the block holding the position, which loadTable checked ends where the next one starts.
+				//Each run is a value followed by its length as a varint
+				std::uint64_t blockOffsets[2];
+				std::memcpy(blockOffsets, pBlockOffsets + (index / BLOCK_SIZE) * sizeof(std::uint64_t), sizeof(blockOffsets));
+				unsigned char const* pRun = pBlocks + blockOffsets[0];
+				unsigned char const* pBlockEnd = pBlocks + blockOffsets[1];
+				std::uint64_t remaining = index % BLOCK_SIZE;
+				while (pRun < pBlockEnd)
+				{
+					std::uint8_t value = *pRun++;
+					std::uint64_t length;
+					if (!readVarint(pRun, pBlockEnd, length))
+					{
+						break;
+					}
+					if (remaining < length)
+					{
+						return value;
+					}
+					remaining -= length;
+				}
+				return INVALID;
+			}
+		};
+
+		using TableMap = std::unordered_map<std::uint32_t, std::unique_ptr<Table>>;
+
+		/// <summary>
+		/// Looks up the stored value of any position in the tables, mirroring it if its material
+		/// is stored with the colors the other way around.
+		/// </summary>
+		bool findValue(TableMap const& tables, TablePosition const& position, std::uint8_t& value)
+		{
+			Material material = position.getMaterial();
+			if (material.getPieceCount() == 2)
+			{
+				value = DRAW;
+				return true;
+			}
+
+			bool isFlipped = material.isBlackStronger();
+			auto table = tables.find((isFlipped ? material.getFlipped() : material).getKey());
+			if (table == tables.end())
+			{
+				return false;
+			}
+
+			TablePosition oriented = position;
+			if (isFlipped)
+			{
+				oriented.isWhiteMove = !oriented.isWhiteMove;
+				for (int i = 0; i < oriented.pieceCount; ++i)
+				{
+					oriented.pieces[i].isWhite = !oriented.pieces[i].isWhite;
+					oriented.pieces[i].square = static_cast<Square>(oriented.pieces[i].square ^ 56);
+				}
+			}
+
+			TableLayout const& layout = table->second->layout;
+			TablePosition arranged;
+			layout.arrange(oriented, arranged);
+			value = table->second->getValue(layout.encode(arranged));
+			return true;
+		}
+
+		/// <summary>
+		/// Runs a function over a range of indices on several threads. Each call is given a block of indices
+		/// that is a multiple of 64 long, so that threads never share a word of a bitset indexed the same way.
+		/// </summary>
+		template <typename Body>
+		void parallelFor(std::uint64_t count, unsigned int threadCount, Body const& body)
+		{
+			std::uint64_t constexpr BLOCK = 1 << 16;
+			std::atomic<std::uint64_t> next(0);
+			auto worker = [&]()
+			{
+				for (std::uint64_t begin = next.fetch_add(BLOCK); begin < count; begin = next.fetch_add(BLOCK))
+				{
+					body(begin, std::min(begin + BLOCK, count));
+				}
+			};
+
+			std::vector<std::thread> threads;
+			for (unsigned int i = 1; i < threadCount; ++i)
+			{
+				threads.emplace_back(worker);
+			}
+			worker();
+			for (std::thread& thread : threads)
+			{
+				thread.join();
+			}
+		}
+
+		/// <summary>
+		/// Generates the values of a table by retrograde analysis. The tables its captures and promotions lead into must already be in tables.
+		/// </summary>
+		std::vector<std::uint8_t> generateValues(TableLayout const& layout, TableMap const& tables, unsigned int threadCount)
+		{
+			std::uint64_t entryCount = layout.entryCount;
+			std::vector<std::uint8_t> values(entryCount, DRAW);
+
+			//The pass at which a position should be looked at again because of a capture or promotion,
+			//which is one more than the distance to mate of the smaller table's position it leads to
+			std::vector<std::uint8_t> exitPasses(entryCount, 0);
+			std::atomic<int> lastExitPass(0);
+
+			parallelFor(entryCount, threadCount, [&](std::uint64_t begin, std::uint64_t end)
+			{
+				int threadLastExitPass = 0;
+				TablePosition position;
+				for (std::uint64_t index = begin; index < end; ++index)
+				{
+					layout.decode(index, position);
+					if (!isValid(position))
+					{
+						values[index] = INVALID;
+						continue;
+					}
+
+					bool hasMove = false;
+					bool hasExitDraw = false;
+					int shortestExitLoss = MAX_STORED_VALUE;
+					int longestExitWin = -1;
+					forEachMove(position, [&](TablePosition const& child, bool isSameMaterial)
+					{
+						hasMove = true;
+						std::uint8_t value;
+						if (!isSameMaterial && findValue(tables, child, value))
+						{
+							int distance = value - 1;
+							if (value == DRAW)
+							{
+								hasExitDraw = true;
+							}
+							else if (distance % 2 == 0)
+							{
+								shortestExitLoss = std::min(shortestExitLoss, distance);
+							}
+							else
+							{
+								longestExitWin = std::max(longestExitWin, distance);
+							}
+						}
+						return true;
+					});
+
+					if (!hasMove)
+					{
+						//Checkmate is mate in 0, and stalemate stays a draw
+						values[index] = isInCheck(position) ? 1 : DRAW;
+						continue;
+					}
+
+					int exitPass = shortestExitLoss < MAX_STORED_VALUE ? shortestExitLoss + 1
+						: !hasExitDraw && longestExitWin >= 0 ? longestExitWin + 1
+						: 0;
+					exitPasses[index] = static_cast<std::uint8_t>(exitPass);
+					threadLastExitPass = std::max(threadLastExitPass, exitPass);
+				}
+
+				int previous = lastExitPass.load();
+				while (threadLastExitPass > previous && !lastExitPass.compare_exchange_weak(previous, threadLastExitPass))
+				{
+				}
+			});
+
+			std::uint64_t wordCount = (entryCount + 63) / 64;
+			std::unique_ptr<std::atomic<std::uint64_t>[]> candidates(new std::atomic<std::uint64_t>[wordCount]);
+
+			//Pass n finds the positions that are mated or mate in exactly n plies
+			for (int pass = 1; ; ++pass)
+			{
+				if (pass >= MAX_STORED_VALUE)
+				{
+					throw std::runtime_error("Tablebase " + layout.name + " has mates too long to store");
+				}
+
+				for (std::uint64_t i = 0; i < wordCount; ++i)
+				{
+					candidates[i].store(0, std::memory_order_relaxed);
+				}
+
+				//Candidates are the positions one move before those found on the last pass,
+				//found by unmaking the moves of the side that just moved
+				parallelFor(entryCount, threadCount, [&](std::uint64_t begin, std::uint64_t end)
+				{
+					TablePosition position;
+					for (std::uint64_t index = begin; index < end; ++index)
+					{
+						if (exitPasses[index] == pass)
+						{
+							candidates[index / 64].fetch_or(std::uint64_t(1) << (index % 64), std::memory_order_relaxed);
+						}
+						if (values[index] != pass)
+						{
+							continue;
+						}
+
+						layout.decode(index, position);
+						bool isWhite = !position.isWhiteMove;
+						Bitboard occupancy = position.getOccupancy();
+						for (int i = 0; i < position.pieceCount; ++i)
+						{
+							TablePiece const& piece = position.pieces[i];
+							if (piece.isWhite != isWhite)
+							{
+								continue;
+							}
+
+							Bitboard origins;
+							if (piece.type == PieceType::Pawn)
+							{
+								int backward = isWhite ? -8 : 8;
+								int rank = piece.square / 8;
+								Square pushOrigin = static_cast<Square>(piece.square + backward);
+								origins = EMPTY_BITBOARD;
+								if ((isWhite ? rank >= 2 : rank <= 5) && (occupancy & toBitboard(pushOrigin)) == EMPTY_BITBOARD)
+								{
+									origins |= toBitboard(pushOrigin);
+									Square doublePushOrigin = static_cast<Square>(pushOrigin + backward);
+									if (rank == (isWhite ? 3 : 4) && (occupancy & toBitboard(doublePushOrigin)) == EMPTY_BITBOARD)
+									{
+										origins |= toBitboard(doublePushOrigin);
+									}
+								}
+							}
+							else
+							{
+								origins = getAttacks(piece, occupancy) & ~occupancy;
+							}
+
+							TablePosition predecessor = position;
+							predecessor.isWhiteMove = isWhite;
+							while (origins != EMPTY_BITBOARD)
+							{
+								predecessor.pieces[i].square = popLowestSquare(origins);
+								std::uint64_t predecessorIndex = layout.encode(predecessor);
+								candidates[predecessorIndex / 64].fetch_or(std::uint64_t(1) << (predecessorIndex % 64), std::memory_order_relaxed);
+							}
+						}
+					}
+				});
+
+				//Confirm each candidate by looking at all of its moves. A win needs a move to a position lost
+				//on the last pass, and a loss needs every move to lead to a win with the longest found on the last pass
+				bool isWinPass = pass % 2 == 1;
+				parallelFor(entryCount, threadCount, [&](std::uint64_t begin, std::uint64_t end)
+				{
+					TablePosition position;
+					for (std::uint64_t word = begin / 64; word < (end + 63) / 64; ++word)
+					{
+						std::uint64_t bits = candidates[word].load(std::memory_order_relaxed);
+						std::uint64_t confirmed = 0;
+						while (bits != 0)
+						{
+							std::uint64_t index = word * 64 + lowestSquare(bits);
+							bits &= bits - 1;
+							if (values[index] != DRAW)
+							{
+								continue;
+							}
+
+							layout.decode(index, position);
+							bool isConfirmed = !isWinPass;
+							bool hasMove = false;
+							forEachMove(position, [&](TablePosition const& child, bool isSameMaterial)
+							{
+								hasMove = true;
+								std::uint8_t value = DRAW;
+								if (isSameMaterial)
+								{
+									value = values[layout.encode(child)];
+								}
+								else
+								{
+									findValue(tables, child, value);
+								}
+
+								if (isWinPass)
+								{
+									isConfirmed = value == pass;
+									return !isConfirmed;
+								}
+								isConfirmed = value != DRAW && value != INVALID && value <= pass && (value - 1) % 2 == 1;
+								return isConfirmed;
+							});
+
+							if (isConfirmed && hasMove)
+							{
+								confirmed |= std::uint64_t(1) << (index % 64);
+							}
+						}
+						candidates[word].store(confirmed, std::memory_order_relaxed);
+					}
+				});
+
+				std::atomic<std::uint64_t> foundCount(0);
+				parallelFor(entryCount, threadCount, [&](std::uint64_t begin, std::uint64_t end)
+				{
+					std::uint64_t count = 0;
+					for (std::uint64_t word = begin / 64; word < (end + 63) / 64; ++word)
+					{
+						std::uint64_t bits = candidates[word].load(std::memory_order_relaxed);
+						while (bits != 0)
+						{
+							values[word * 64 + lowestSquare(bits)] = static_cast<std::uint8_t>(pass + 1);
+							bits &= bits - 1;
+							++count;
+						}
+					}
+					foundCount += count;
+				});
+
+				if (foundCount == 0 && pass >= lastExitPass)
+				{
+					break;
+				}
+			}
+			return values;
+		}
+
+		std::string getTablePath(std::string const& directory, std::string const& name)
+		{
+			return (std::filesystem::path(directory) / (name + FILE_EXTENSION)).string();
+		}
+
+		void writeVarint(std::vector<unsigned char>& data, std::uint64_t value)
+		{
+			while (value >= 0x80)
+			{
+				data.push_back(static_cast<unsigned char>(value | 0x80));
+				value >>= 7;
+			}
+			data.push_back(static_cast<unsigned char>(value));
+		}
+
+		/// <summary>
+		/// Writes a table, run length encoding each block of values.
+		/// </summary>
+		void writeTable(std::string const& path, TableLayout const& layout, std::vector<std::uint8_t> const& values)
+		{
+			std::uint64_t blockCount = (layout.entryCount + BLOCK_SIZE - 1) / BLOCK_SIZE;
+			std::vector<std::uint64_t> blockOffsets;
+			std::vector<unsigned char> blocks;
+			std::uint8_t previous = DRAW;
+			for (std::uint64_t block = 0; block < blockCount; ++block)
+			{
+				blockOffsets.push_back(blocks.size());
+				std::uint64_t end = std::min<std::uint64_t>((block + 1) * BLOCK_SIZE, layout.entryCount);
+				for (std::uint64_t index = block * BLOCK_SIZE; index < end; )
+				{
+					//Positions that cannot occur are never probed, so they join whichever run they are next to
+					std::uint8_t value = values[index] == INVALID ? previous : values[index];
+					std::uint64_t runEnd = index + 1;
+					while (runEnd < end && (values[runEnd] == value || values[runEnd] == INVALID))
+					{
+						++runEnd;
+					}
+					blocks.push_back(value);
+					writeVarint(blocks, runEnd - index);
+					previous = value;
+					index = runEnd;
+				}
+			}
+			blockOffsets.push_back(blocks.size());
+
+			FileHeader header = {};
+			std::memcpy(header.magic, MAGIC, sizeof(MAGIC));
+			header.version = VERSION;
+			header.pieceCount = static_cast<std::uint32_t>(layout.pieceCount);
+			header.blockSize = BLOCK_SIZE;
+			header.entryCount = layout.entryCount;
+			header.blockCount = blockCount;
+			std::strncpy(header.material, layout.name.c_str(), sizeof(header.material) - 1);
+
+			std::ofstream file(path, std::ios::binary | std::ios::trunc);
+			file.write(reinterpret_cast<char const*>(&header), sizeof(header));
+			file.write(reinterpret_cast<char const*>(blockOffsets.data()), blockOffsets.size() * sizeof(std::uint64_t));
+			file.write(reinterpret_cast<char const*>(blocks.data()), blocks.size());
+			file.close();
+			if (file.fail())
+			{
+				throw std::runtime_error("Could not write tablebase: " + path);
+			}
+		}
+
+		/// <summary>
+		/// Memory maps a table file and checks that it matches its material.
+		/// </summary>
+		std::unique_ptr<Table> loadTable(std::string const& path)
+		{
+			auto invalidTable = [&path](char const* reason)
+			{
+				return std::runtime_error("Invalid tablebase file (" + std::string(reason) + "): " + path);
+			};
+
+			auto pFile = std::make_unique<MemoryMappedFile>(path);
+			FileHeader header;
+			if (pFile->getSize() < sizeof(header))
+			{
+				throw invalidTable("too small");
+			}
+			std::memcpy(&header, pFile->getData(), sizeof(header));
+			if (std::memcmp(header.magic, MAGIC, sizeof(MAGIC)) != 0 || header.version != VERSION || header.blockSize != BLOCK_SIZE)
+			{
+				throw invalidTable("unknown format");
+			}
+
+			header.material[sizeof(header.material) - 1] = '\0';
+			Material material;
+			try
+			{
+				material = parseMaterial(header.material);
+			}
+			catch (std::invalid_argument const&)
+			{
+				throw invalidTable("unknown material");
+			}
+
+			auto pTable = std::make_unique<Table>(TableLayout(material));
+			std::uint64_t indexSize = (header.blockCount + 1) * sizeof(std::uint64_t);
+			std::uint64_t dataSize;
+			if (material.isBlackStronger() || pTable->layout.entryCount != header.entryCount
+				|| header.blockCount != (header.entryCount + BLOCK_SIZE - 1) / BLOCK_SIZE
+				|| pFile->getSize() < sizeof(header) + indexSize
+				|| (std::memcpy(&dataSize, pFile->getData() + sizeof(header) + indexSize - sizeof(dataSize), sizeof(dataSize)), dataSize != pFile->getSize() - sizeof(header) - indexSize))
+			{
+				throw invalidTable("wrong size");
+			}
+
+			//Every block holds at least one run, so each block must start before the next one, and the last before the end of the data
+			unsigned char const* pBlockOffsets = pFile->getData() + sizeof(header);
+			std::uint64_t previousOffset = 0;
+			for (std::uint64_t block = 0; block <= header.blockCount; ++block)
+			{
+				std::uint64_t offset;
+				std::memcpy(&offset, pBlockOffsets + block * sizeof(offset), sizeof(offset));
+				if ((block == 0 ? offset != 0 : offset <= previousOffset) || offset > dataSize)
+				{
+					throw invalidTable("bad block offsets");
+				}
+				previousOffset = offset;
+			}
+
+			pTable->pBlockOffsets = pBlockOffsets;
+			pTable->pBlocks = pTable->pBlockOffsets + indexSize;
+			pTable->pFile = std::move(pFile);
+			return pTable;
+		}
+
+		/// <summary>
+		/// Makes sure the table for some material, and every table it depends on, is in tables,
+		/// loading it from the directory or generating it. Generated tables are written to the directory.
+		/// </summary>
+		void ensureTable(Material const& material, std::string const& directory, unsigned int threadCount, TableMap& tables)
+		{
+			if (material.getPieceCount() == 2 || tables.count(material.getKey()) != 0)
+			{
+				return;
+			}
+
+			TableLayout layout(material);
+			std::string path = getTablePath(directory, layout.name);
+			if (std::filesystem::exists(path))
+			{
+				//Probing a mapped table decodes a block per lookup, so generation works from a decoded copy
+				std::unique_ptr<Table> pTable = loadTable(path);
+				pTable->values.resize(layout.entryCount);
+				for (std::uint64_t index = 0; index < layout.entryCount; ++index)
+				{
+					pTable->values[index] = pTable->getValue(index);
+					if (pTable->values[index] == INVALID)
+					{
+						//The writer gives positions that cannot occur the value of a neighbouring run, so the runs are corrupt
+						throw std::runtime_error("Invalid tablebase file (bad runs): " + path);
+					}
+				}
+				pTable->pFile.reset();
+				tables[material.getKey()] = std::move(pTable);
+				return;
+			}
+
+			//Captures and promotions lead into tables with one piece fewer or one pawn promoted
+			for (int color = 0; color < 2; ++color)
+			{
+				for (PieceType type : TABLE_ORDER)
+				{
+					int typeIndex = static_cast<int>(type);
+					if (material.counts[color][typeIndex] == 0)
+					{
+						continue;
+					}
+
+					Material captured = material;
+					--captured.counts[color][typeIndex];
+					ensureTable(captured.isBlackStronger() ? captured.getFlipped() : captured, directory, threadCount, tables);
+
+					if (type == PieceType::Pawn)
+					{
+						for (PieceType promotion : { PieceType::Queen, PieceType::Rook, PieceType::Bishop, PieceType::Knight })
+						{
+							Material promoted = captured;
+							++promoted.counts[color][static_cast<int>(promotion)];
+							ensureTable(promoted.isBlackStronger() ? promoted.getFlipped() : promoted, directory, threadCount, tables);
+						}
+					}
+				}
+			}
+
+			auto pTable = std::make_unique<Table>(layout);
+			pTable->values = generateValues(layout, tables, threadCount);
+			writeTable(path, layout, pTable->values);
+			tables[material.getKey()] = std::move(pTable);
+		}
+
+		/// <summary>
+		/// Converts a board to a tablebase position, if it can be covered by a table.
+		/// </summary>
+		bool toTablePosition(Board const& board, TablePosition& position)
+		{
+			//Every table has exactly one king per side, and only those with the bare kings are found without a table
+			if (board.getCastlingRights() != NO_CASTLING || board.getEnPassantSquare() != NO_SQUARE
+				|| popCount(board.getOccupancy()) > MAX_PIECES
+				|| popCount(board.getBitboard(true, PieceType::King)) != 1 || popCount(board.getBitboard(false, PieceType::King)) != 1)
+			{
+				return false;
+			}
+
+			position.pieceCount = 0;
+			position.isWhiteMove = board.isWhiteMove();
+			for (int color = 0; color < 2; ++color)
+			{
+				for (int type = 0; type < 6; ++type)
+				{
+					Bitboard pieces = board.getBitboard(color == 0, static_cast<PieceType>(type));
+					while (pieces != EMPTY_BITBOARD)
+					{
+						position.pieces[position.pieceCount++] = { color == 0, static_cast<PieceType>(type), popLowestSquare(pieces) };
+					}
+				}
+			}
+			return true;
+		}
+	}
+
+	struct Tablebase::Impl
+	{
+		TableMap tables;
+		int maxPieceCount = 0;
+	};
+
+	Tablebase::Tablebase()
+		: m_pImpl(std::make_unique<Impl>())
+	{}
+
+	Tablebase::Tablebase(std::string const& directory)
+		: m_pImpl(std::make_unique<Impl>())
+	{
+		std::error_code error;
+		for (auto const& entry : std::filesystem::directory_iterator(directory, error))
+		{
+			if (entry.path().extension() != FILE_EXTENSION)
+			{
+				continue;
+			}
+
+			std::unique_ptr<Table> pTable = loadTable(entry.path().string());
+			m_pImpl->maxPieceCount = std::max(m_pImpl->maxPieceCount, pTable->layout.pieceCount);
+			m_pImpl->tables[pTable->layout.material.getKey()] = std::move(pTable);
+		}
+		if (error)
+		{
+			throw std::runtime_error("Could not read tablebase directory (" + error.message() + "): " + directory);
+		}
+	}
+
+	Tablebase::~Tablebase() = default;
+
+	std::size_t Tablebase::getTableCount() const
+	{
+		return m_pImpl->tables.size();
+	}
+
+	int Tablebase::getMaxPieceCount() const
+	{
+		return m_pImpl->maxPieceCount;
+	}
+
+	bool Tablebase::probe(Board const& board, TablebaseResult& result) const
+	{
+		TablePosition position;
+		std::uint8_t value;
+		if (!toTablePosition(board, position) || !findValue(m_pImpl->tables, position, value) || value == INVALID)
+		{
+			return false;
+		}
+
+		result.pliesToMate = value == DRAW ? 0 : value - 1u;
+		result.outcome = value == DRAW ? 0 : result.pliesToMate % 2 == 1 ? 1 : -1;
+		return true;
+	}
+
+	Move Tablebase::findBestMove(Board const& board) const
+	{
+		TablebaseResult result;
+		if (!probe(board, result))
+		{
+			return Move();
+		}
+
+		//Score each move from the mover's point of view: faster wins and slower losses score higher
+		Board childBoard(board);
+		Move bestMove;
+		int bestScore = 0;
+		for (Move move : board.generateLegalMoves())
+		{
+			UndoRecord undoRecord;
+			childBoard.makeMove(move, undoRecord);
+			TablebaseResult childResult;
+			bool isCovered = probe(childBoard, childResult);
+			childBoard.unmakeMove(move, undoRecord);
+			if (!isCovered)
+			{
+				continue;
+			}
+
+			int score = childResult.outcome == 0 ? 0
+				: childResult.outcome < 0 ? 1000 - static_cast<int>(childResult.pliesToMate)
+				: -1000 + static_cast<int>(childResult.pliesToMate);
+			if (bestMove == Move() || score > bestScore)
+			{
+				bestMove = move;
+				bestScore = score;
+			}
+		}
+		return bestMove;
+	}
+
+	std::string Tablebase::generate(std::string const& material, std::string const& directory, unsigned int threadCount)
+	{
+		Material parsed = parseMaterial(material);
+		if (parsed.isBlackStronger())
+		{
+			parsed = parsed.getFlipped();
+		}
+
+		TableMap tables;
+		ensureTable(parsed, directory, std::max(1u, threadCount), tables);
+		return parsed.getName();
+	}
+}
+}
@@ -0,0 +1,229 @@
+// Author:	Liam Scholte
+// Created:	10/17/2026 3:58:12 PM
+// This file contains the implementations for TranspositionTable
+// See TranspositionTable.h for documentation
+
+#include <Chess/Model/TranspositionTable.h>
+
+#include <algorithm>
+#include <atomic>
+
+#if defined(_MSC_VER)
+#include <xmmintrin.h>
+#endif
+
+namespace Chess
+{
+namespace Model
+{
+	namespace
+	{
+		/// <summary>
+		/// An entry packed into two words. The data word holds, from the lowest bit up,
+		/// the move (16 bits), score (16 bits), 16 unused bits, depth offset by -MIN_DEPTH (8 bits),
+		/// bound (2 bits) and the generation of the search that stored it (6 bits).
+		/// </summary>
+		struct Entry
+		{
+			std::atomic<std::uint64_t> keyXorData;
+			std::atomic<std::uint64_t> data;
+		};
+
+		int constexpr ENTRIES_PER_BUCKET = 4;
+		int constexpr GENERATION_COUNT = 64;
+
+		struct alignas(64) Bucket
+		{
+			Entry entries[ENTRIES_PER_BUCKET];
+		};
+
+		static_assert(sizeof(Bucket) == 64, "A bucket must fill exactly one cache line");
+
+		std::uint64_t pack(Move move, int score, int depth, Bound bound, unsigned int generation)
+		{
+			return std::uint64_t(move.getData())
+				| std::uint64_t(static_cast<std::uint16_t>(score)) << 16
+				| std::uint64_t(depth - TranspositionTable::MIN_DEPTH) << 48
+				| std::uint64_t(static_cast<unsigned int>(bound)) << 56
+				| std::uint64_t(generation) << 58;
+		}
+
+		Move unpackMove(std::uint64_t data)
+		{
+			return Move(static_cast<std::uint16_t>(data));
+		}
+
+		int unpackDepth(std::uint64_t data)
+		{
+			return static_cast<int>((data >> 48) & 0xFF) + TranspositionTable::MIN_DEPTH;
+		}
+
+		Bound unpackBound(std::uint64_t data)
+		{
+			return static_cast<Bound>((data >> 56) & 0x3);
+		}
+
+		unsigned int unpackGeneration(std::uint64_t data)
+		{
+			return static_cast<unsigned int>(data >> 58);
+		}
+	}
+
+	struct TranspositionTable::Impl
+	{
+		std::unique_ptr<Bucket[]> buckets;
+		std::size_t bucketMask;
+		unsigned int generation;
+
+		Impl(std::size_t sizeInMegabytes)
+			: bucketMask(0)
+			, generation(0)
+		{
+			allocate(sizeInMegabytes);
+		}
+
+		void allocate(std::size_t sizeInMegabytes)
+		{
+			//A power of two number of buckets lets the low bits of the key pick the bucket
+			std::size_t bucketCount = 1;
+			while (bucketCount * 2 * sizeof(Bucket) <= sizeInMegabytes * 1024 * 1024)
+			{
+				bucketCount *= 2;
+			}
+
+			//Value initialization zeroes every entry, and an all zero entry has no bound so it reads as empty
+			buckets = std::make_unique<Bucket[]>(bucketCount);
+			bucketMask = bucketCount - 1;
+		}
+
+		Bucket& getBucket(std::uint64_t key) const
+		{
+			return buckets[key & bucketMask];
+		}
+	};
+
+	TranspositionTable::TranspositionTable(std::size_t sizeInMegabytes)
+		: m_pImpl(std::make_unique<Impl>(sizeInMegabytes))
+	{}
+
+	TranspositionTable::~TranspositionTable() = default;
+
+	void TranspositionTable::resize(std::size_t sizeInMegabytes)
+	{
+		m_pImpl->buckets.reset();
+		m_pImpl->allocate(sizeInMegabytes);
+		m_pImpl->generation = 0;
+	}
+
+	std::size_t TranspositionTable::getSizeInBytes() const
+	{
+		return (m_pImpl->bucketMask + 1) * sizeof(Bucket);
+	}
+
+	void TranspositionTable::clear()
+	{
+		for (std::size_t i = 0; i <= m_pImpl->bucketMask; ++i)
+		{
+			for (Entry& entry : m_pImpl->buckets[i].entries)
+			{
+				entry.keyXorData.store(0, std::memory_order_relaxed);
+				entry.data.store(0, std::memory_order_relaxed);
+			}
+		}
+		m_pImpl->generation = 0;
+	}
+
+	void TranspositionTable::newSearch()
+	{
+		m_pImpl->generation = (m_pImpl->generation + 1) % GENERATION_COUNT;
+	}
+
+	bool TranspositionTable::probe(std::uint64_t key, TranspositionEntry& entry) const
+	{
+		for (Entry const& storedEntry : m_pImpl->getBucket(key).entries)
+		{
+			std::uint64_t data = storedEntry.data.load(std::memory_order_relaxed);
+			if ((storedEntry.keyXorData.load(std::memory_order_relaxed) ^ data) != key || unpackBound(data) == Bound::None)
+			{
+				continue;
+			}
+
+			entry.move = unpackMove(data);
+			entry.score = static_cast<std::int16_t>(data >> 16);
+			entry.depth = unpackDepth(data);
+			entry.bound = unpackBound(data);
+			return true;
+		}
+		return false;
+	}
+
+	void TranspositionTable::store(std::uint64_t key, Move move, int score, int depth, Bound bound)
+	{
+		unsigned int generation = m_pImpl->generation;
+		depth = std::max(MIN_DEPTH, std::min(MAX_DEPTH, depth));
+
+		Entry* pReplace = nullptr;
+		int lowestWorth = 0;
+		for (Entry& storedEntry : m_pImpl->getBucket(key).entries)
+		{
+			std::uint64_t data = storedEntry.data.load(std::memory_order_relaxed);
+			if ((storedEntry.keyXorData.load(std::memory_order_relaxed) ^ data) == key && unpackBound(data) != Bound::None)
+			{
+				//Keep a deeper result for this position from the current search
+				if (bound != Bound::Exact && unpackGeneration(data) == generation && unpackDepth(data) > depth)
+				{
+					return;
+				}
+				if (move == Move())
+				{
+					move = unpackMove(data);
+				}
+				pReplace = &storedEntry;
+				break;
+			}
+
+			//Prefer to replace empty entries, then entries from old searches, then shallow entries
+			int age = static_cast<int>((GENERATION_COUNT + generation - unpackGeneration(data)) % GENERATION_COUNT);
+			int worth = unpackBound(data) == Bound::None
+				? MIN_DEPTH - 8 * GENERATION_COUNT
+				: unpackDepth(data) - 8 * age;
+			if (!pReplace || worth < lowestWorth)
+			{
+				pReplace = &storedEntry;
+				lowestWorth = worth;
+			}
+		}
+
+		std::uint64_t data = pack(move, score, depth, bound, generation);
+		pReplace->keyXorData.store(key ^ data, std::memory_order_relaxed);
+		pReplace->data.store(data, std::memory_order_relaxed);
+	}
+
+	void TranspositionTable::prefetch(std::uint64_t key) const
+	{
+#if defined(_MSC_VER)
+		_mm_prefetch(reinterpret_cast<char const*>(&m_pImpl->getBucket(key)), _MM_HINT_T0);
+#else
+		__builtin_prefetch(&m_pImpl->getBucket(key));
+#endif
+	}
+
+	int TranspositionTable::getHashfull() const
+	{
+		std::size_t sampledBuckets = std::min<std::size_t>(1000 / ENTRIES_PER_BUCKET, m_pImpl->bucketMask + 1);
+		int used = 0;
+		for (std::size_t i = 0; i < sampledBuckets; ++i)
+		{
+			for (Entry const& storedEntry : m_pImpl->buckets[i].entries)
+			{
+				std::uint64_t data = storedEntry.data.load(std::memory_order_relaxed);
+				if (unpackBound(data) != Bound::None && unpackGeneration(data) == m_pImpl->generation)
+				{
+					++used;
+				}
+			}
+		}
+		return static_cast<int>(used * 1000 / (sampledBuckets * ENTRIES_PER_BUCKET));
+	}
+}
+}
@@ -0,0 +1,233 @@
+// Author:	Liam Scholte
+// Created:	10/17/2026 11:51:08 PM
+// This file contains a command line tool that checks the neural network kernels.
+// It plays random games with the network loaded once for each instruction set the
+// processor supports, and checks that every set of kernels evaluates each position
+// the same as the scalar kernels, and that the accumulator the board updates move
+// by move matches one refreshed from scratch.
+//
+// A network with random weights can be generated first, so the kernels can be
+// checked without a trained network.
+//
+// Usage:
+//	ChessNetworkCheck <network> [--generate] [--seed <n>] [--games <n>] [--plies <n>]
+
+#include <Chess/Model/Board.h>
+#include <Chess/Model/Move.h>
+#include <Chess/Model/MoveList.h>
+#include <Chess/Model/NeuralNetwork.h>
+#include <Chess/Model/Search.h>
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+namespace
+{
+	using namespace Chess::Model;
+
+	struct Options
+	{
+		std::string path;
+		bool isGenerating = false;
+		std::uint32_t seed = 1;
+		int games = 20;
+		int plies = 200;
+	};
+
+	bool parseOptions(int argc, char* argv[], Options& options)
+	{
+		for (int i = 1; i < argc; ++i)
+		{
+			std::string argument = argv[i];
+			bool hasValue = i + 1 < argc;
+			if (argument == "--generate")
+			{
+				options.isGenerating = true;
+			}
+			else if (argument == "--seed" && hasValue)
+			{
+				options.seed = static_cast<std::uint32_t>(std::strtoul(argv[++i], nullptr, 10));
+			}
+			else if (argument == "--games" && hasValue)
+			{
+				options.games = std::max(1, std::atoi(argv[++i]));
+			}
+			else if (argument == "--plies" && hasValue)
+			{
+				options.plies = std::max(1, std::atoi(argv[++i]));
+			}
+			else if (options.path.empty() && argument.rfind("--", 0) != 0)
+			{
+				options.path = argument;
+			}
+			else
+			{
+				return false;
+			}
+		}
+		return !options.path.empty();
+	}
+
+	/// <summary>
+	/// Writes a network with random weights in the layout described by NeuralNetwork.
+	/// The weights are small enough that the hidden values stay within their 16-bit range.
+	/// </summary>
+	void generateNetwork(std::string const& path, std::uint32_t seed)
+	{
+		std::ofstream file(path, std::ios::binary | std::ios::trunc);
+		if (!file.is_open())
+		{
+			throw std::runtime_error("Could not create network: " + path);
+		}
+
+		auto writeLittleEndian = [&file](std::uint32_t value, int size)
+		{
+			for (int i = 0; i < size; ++i)
+			{
+				file.put(static_cast<char>(value >> (8 * i)));
+			}
+		};
+
+		file.write("ARCN", 4);
+		writeLittleEndian(1, 4);
+		writeLittleEndian(NeuralNetwork::FEATURE_COUNT, 4);
+		writeLittleEndian(NeuralNetwork::HIDDEN_SIZE, 4);
+		for (int i = 16; i < 64; ++i)
+		{
+			file.put(0);
+		}
+
+		std::mt19937 random(seed);
+		auto writeWeights = [&random, &writeLittleEndian](std::size_t count, int low, int high)
+		{
+			std::uniform_int_distribution<int> distribution(low, high);
+			for (std::size_t i = 0; i < count; ++i)
+			{
+				writeLittleEndian(static_cast<std::uint16_t>(distribution(random)), 2);
+			}
+		};
+		writeWeights(std::size_t(NeuralNetwork::FEATURE_COUNT) * NeuralNetwork::HIDDEN_SIZE, -48, 48);
+		writeWeights(NeuralNetwork::HIDDEN_SIZE, 0, 160);
+		writeWeights(2 * NeuralNetwork::HIDDEN_SIZE, -64, 64);
+		writeWeights(1, -4096, 4096);
+
+		file.close();
+		if (file.fail())
+		{
+			throw std::runtime_error("Could not write network: " + path);
+		}
+	}
+
+	/// <summary>
+	/// Plays random games on one board per set of kernels and compares their evaluations.
+	/// </summary>
+	/// <returns>True if every evaluation matched</returns>
+	bool checkKernels(Options const& options)
+	{
+		std::vector<char const*> instructionSets = NeuralNetwork::getSupportedInstructionSets();
+		std::vector<std::shared_ptr<NeuralNetwork const>> networks;
+		for (char const* instructionSet : instructionSets)
+		{
+			networks.push_back(std::make_shared<NeuralNetwork const>(options.path, instructionSet));
+		}
+
+		std::mt19937 random(options.seed);
+		std::uint64_t positions = 0;
+		std::uint64_t mismatches = 0;
+		auto check = [&](std::vector<Board> const& boards)
+		{
+			++positions;
+
+			//The scalar kernels come last and are the reference
+			int expected = boards.back().evaluate();
+			for (std::size_t i = 0; i < boards.size(); ++i)
+			{
+				Board refreshed(boards[i].toFen());
+				refreshed.setNeuralNetwork(networks[i]);
+				int score = boards[i].evaluate();
+				if (score != expected || refreshed.evaluate() != score || score <= -MATE_THRESHOLD || score >= MATE_THRESHOLD)
+				{
+					if (mismatches++ < 10)
+					{
+						std::cout << instructionSets[i] << ": " << score << " (refreshed " << refreshed.evaluate()
+							<< ", scalar " << expected << ") in " << boards[i].toFen() << "\n";
+					}
+				}
+			}
+		};
+
+		for (int game = 0; game < options.games; ++game)
+		{
+			std::vector<Board> boards(networks.size());
+			for (std::size_t i = 0; i < boards.size(); ++i)
+			{
+				boards[i].setNeuralNetwork(networks[i]);
+			}
+			check(boards);
+
+			for (int ply = 0; ply < options.plies; ++ply)
+			{
+				MoveList moves = boards.front().generateLegalMoves();
+				if (moves.empty())
+				{
+					break;
+				}
+
+				//Taking some moves back and playing them again also exercises the opposite updates
+				Move move = moves[random() % moves.size()];
+				bool isTakenBack = random() % 4 == 0;
+				for (Board& board : boards)
+				{
+					UndoRecord undoRecord;
+					board.makeMove(move, undoRecord);
+					if (isTakenBack)
+					{
+						board.unmakeMove(move, undoRecord);
+						board.makeMove(move, undoRecord);
+					}
+				}
+				check(boards);
+			}
+		}
+
+		std::cout << "Checked " << positions << " positions with the";
+		for (char const* instructionSet : instructionSets)
+		{
+			std::cout << " " << instructionSet;
+		}
+		std::cout << " kernels: " << (mismatches == 0 ? "all agree" : std::to_string(mismatches) + " mismatches") << "\n";
+		return mismatches == 0;
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	Options options;
+	if (!parseOptions(argc, argv, options))
+	{
+		std::cerr << "Usage: ChessNetworkCheck <network> [--generate] [--seed <n>] [--games <n>] [--plies <n>]\n";
+		return EXIT_FAILURE;
+	}
+
+	try
+	{
+		if (options.isGenerating)
+		{
+			generateNetwork(options.path, options.seed);
+		}
+		return checkKernels(options) ? EXIT_SUCCESS : EXIT_FAILURE;
+	}
+	catch (std::exception const& e)
+	{
+		std::cerr << e.what() << "\n";
+		return EXIT_FAILURE;
+	}
+}
@@ -0,0 +1,294 @@
+// Author:	Liam Scholte
+// Created:	10/17/2026 11:52:18 AM
+// This file contains a command line tool that counts the leaf nodes of the
+// move generation tree (perft) for a position. It is used to measure the
+// throughput of move generation and to check it against known node counts.
+//
+// Usage:
+//	ChessPerft [--fen <fen>] [--depth <n>] [--divide] [--threads <n>]
+//	ChessPerft --suite <file.epd> [--max-depth <n>] [--threads <n>]
+//
+// A suite file contains one position per line in the form
+//	<fen> ;D1 <nodes> ;D2 <nodes> ...
+
+#include <Chess/Model/Board.h>
+#include <Chess/Model/Move.h>
+#include <Chess/Model/MoveList.h>
+#include <Chess/Model/Position.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	using namespace Chess::Model;
+
+	struct Options
+	{
+		std::string fen = std::string(START_FEN);
+		int depth = 5;
+		bool divide = false;
+		unsigned int threads = std::max(1u, std::thread::hardware_concurrency());
+		std::string suitePath;
+		int maxDepth = 64;
+	};
+
+	std::string toString(Move move)
+	{
+		Position from = toPosition(move.getFrom());
+		Position to = toPosition(move.getTo());
+
+		std::string text;
+		text += static_cast<char>('a' + from.file - 1);
+		text += static_cast<char>('0' + from.rank);
+		text += static_cast<char>('a' + to.file - 1);
+		text += static_cast<char>('0' + to.rank);
+
+		if (move.isPromotion())
+		{
+			char constexpr promotionSuffixes[] = { 'n', 'b', 'r', 'q' };
+			text += promotionSuffixes[static_cast<int>(move.getFlag()) & 0x3];
+		}
+		return text;
+	}
+
+	std::uint64_t perft(Board& board, int depth)
+	{
+		if (depth <= 0)
+		{
+			return 1;
+		}
+
+		MoveList moves = board.generateLegalMoves();
+		if (depth == 1)
+		{
+			//Bulk count the leaves rather than making each move
+			return moves.size();
+		}
+
+		std::uint64_t nodes = 0;
+		for (Move move : moves)
+		{
+			UndoRecord undoRecord;
+			board.makeMove(move, undoRecord);
+			nodes += perft(board, depth - 1);
+			board.unmakeMove(move, undoRecord);
+		}
+		return nodes;
+	}
+
+	/// <summary>
+	/// Counts the nodes below each root move, splitting the root moves between threads.
+	/// Every thread works on its own copy of the board.
+	/// </summary>
+	std::vector<std::uint64_t> perftRootMoves(Board const& board, MoveList const& rootMoves, int depth, unsigned int threadCount)
+	{
+		std::vector<std::uint64_t> nodes(rootMoves.size(), 0);
+		std::atomic<size_t> nextMove(0);
+
+		auto worker = [&board, &rootMoves, &nodes, &nextMove, depth]()
+		{
+			Board threadBoard(board);
+			for (size_t i = nextMove++; i < rootMoves.size(); i = nextMove++)
+			{
+				UndoRecord undoRecord;
+				threadBoard.makeMove(rootMoves[i], undoRecord);
+				nodes[i] = perft(threadBoard, depth - 1);
+				threadBoard.unmakeMove(rootMoves[i], undoRecord);
+			}
+		};
+
+		threadCount = std::max(1u, std::min<unsigned int>(threadCount, static_cast<unsigned int>(rootMoves.size())));
+		std::vector<std::thread> threads;
+		for (unsigned int i = 1; i < threadCount; ++i)
+		{
+			threads.emplace_back(worker);
+		}
+		worker();
+		for (std::thread& thread : threads)
+		{
+			thread.join();
+		}
+
+		return nodes;
+	}
+
+	std::uint64_t runPerft(Board const& board, int depth, unsigned int threadCount, bool divide)
+	{
+		if (depth <= 0)
+		{
+			return 1;
+		}
+
+		MoveList rootMoves = board.generateLegalMoves();
+		std::vector<std::uint64_t> nodes = perftRootMoves(board, rootMoves, depth, threadCount);
+
+		std::uint64_t totalNodes = 0;
+		for (size_t i = 0; i < rootMoves.size(); ++i)
+		{
+			if (divide)
+			{
+				std::cout << toString(rootMoves[i]) << ": " << nodes[i] << "\n";
+			}
+			totalNodes += nodes[i];
+		}
+		return totalNodes;
+	}
+
+	double elapsedSeconds(std::chrono::steady_clock::time_point start)
+	{
+		return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	}
+
+	int runPosition(Options const& options)
+	{
+		Board board(options.fen);
+
+		if (options.divide)
+		{
+			auto start = std::chrono::steady_clock::now();
+			std::uint64_t nodes = runPerft(board, options.depth, options.threads, true);
+			double seconds = elapsedSeconds(start);
+			std::cout << "\nNodes: " << nodes << "\nTime: " << seconds << " s\nNPS: " << static_cast<std::uint64_t>(nodes / std::max(seconds, 1e-9)) << "\n";
+			return EXIT_SUCCESS;
+		}
+
+		for (int depth = 1; depth <= options.depth; ++depth)
+		{
+			auto start = std::chrono::steady_clock::now();
+			std::uint64_t nodes = runPerft(board, depth, options.threads, false);
+			double seconds = elapsedSeconds(start);
+			std::cout << "perft(" << depth << ") = " << nodes
+				<< "\t" << seconds << " s"
+				<< "\t" << static_cast<std::uint64_t>(nodes / std::max(seconds, 1e-9)) << " nps\n";
+		}
+		return EXIT_SUCCESS;
+	}
+
+	int runSuite(Options const& options)
+	{
+		std::ifstream suite(options.suitePath);
+		if (!suite.is_open())
+		{
+			std::cerr << "Cannot open suite " << options.suitePath << "\n";
+			return EXIT_FAILURE;
+		}
+
+		int failures = 0;
+		std::uint64_t totalNodes = 0;
+		auto start = std::chrono::steady_clock::now();
+
+		std::string line;
+		while (std::getline(suite, line))
+		{
+			size_t separator = line.find(';');
+			if (line.empty() || line[0] == '#' || separator == std::string::npos)
+			{
+				continue;
+			}
+
+			std::string fen = line.substr(0, line.find_last_not_of(' ', separator - 1) + 1);
+			Board board(fen);
+
+			std::istringstream expectations(line.substr(separator));
+			std::string token;
+			std::uint64_t expectedNodes;
+			while (expectations >> token >> expectedNodes)
+			{
+				int depth = std::atoi(token.c_str() + 2);
+				if (token.rfind(";D", 0) != 0 || depth > options.maxDepth)
+				{
+					continue;
+				}
+
+				std::uint64_t nodes = runPerft(board, depth, options.threads, false);
+				totalNodes += nodes;
+				if (nodes != expectedNodes)
+				{
+					++failures;
+					std::cout << "FAIL " << fen << " depth " << depth << ": expected " << expectedNodes << ", got " << nodes << "\n";
+				}
+				else
+				{
+					std::cout << "ok   " << fen << " depth " << depth << ": " << nodes << "\n";
+				}
+			}
+		}
+
+		double seconds = elapsedSeconds(start);
+		std::cout << "\n" << failures << " failure(s), " << totalNodes << " nodes in " << seconds << " s ("
+			<< static_cast<std::uint64_t>(totalNodes / std::max(seconds, 1e-9)) << " nps)\n";
+		return failures == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+	}
+
+	bool parseOptions(int argc, char* argv[], Options& options)
+	{
+		for (int i = 1; i < argc; ++i)
+		{
+			std::string argument = argv[i];
+			bool hasValue = i + 1 < argc;
+			if (argument == "--fen" && hasValue)
+			{
+				options.fen = argv[++i];
+			}
+			else if (argument == "--depth" && hasValue)
+			{
+				options.depth = std::atoi(argv[++i]);
+			}
+			else if (argument == "--divide")
+			{
+				options.divide = true;
+			}
+			else if (argument == "--threads" && hasValue)
+			{
+				options.threads = std::max(1, std::atoi(argv[++i]));
+			}
+			else if (argument == "--suite" && hasValue)
+			{
+				options.suitePath = argv[++i];
+			}
+			else if (argument == "--max-depth" && hasValue)
+			{
+				options.maxDepth = std::atoi(argv[++i]);
+			}
+			else
+			{
+				return false;
+			}
+		}
+		return true;
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	Options options;
+	if (!parseOptions(argc, argv, options))
+	{
+		std::cerr
+			<< "Usage: ChessPerft [--fen <fen>] [--depth <n>] [--divide] [--threads <n>]\n"
+			<< "       ChessPerft --suite <file.epd> [--max-depth <n>] [--threads <n>]\n";
+		return EXIT_FAILURE;
+	}
+
+	try
+	{
+		return options.suitePath.empty()
+			? runPosition(options)
+			: runSuite(options);
+	}
+	catch (std::exception const& e)
+	{
+		std::cerr << e.what() << "\n";
+		return EXIT_FAILURE;
+	}
+}
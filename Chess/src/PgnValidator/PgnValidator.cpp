@@ -0,0 +1,487 @@
+// Author:	Liam Scholte
+// Created:	10/17/2026 8:43:05 PM
+// This file contains a command line tool that replays every game in a Portable
+// Game Notation (PGN) file through the move legality rules of the model. The file
+// is memory mapped and split into chunks of whole games, which are replayed by a
+// pool of threads. It reports any move that is malformed or illegal along with
+// the throughput, so it doubles as a benchmark for move generation at scale.
+//
+// The valid games can be written to a binary game record file, and game record
+// files can be replayed the same way to compare against the cost of parsing PGN.
+// The opening moves of the valid games can also be collected into an opening book,
+// and positions can be probed to print their Polyglot key and book moves.
+//
+// Usage:
+//	ChessPgnValidator <file.pgn> [--output <file.bin>] [--book <file.bin>] [--book-plies <n>] [--threads <n>] [--max-errors <n>] [--probe <fen>]...
+//	ChessPgnValidator --records <file.bin> [--book <file.bin>] [--book-plies <n>] [--threads <n>] [--max-errors <n>] [--probe <fen>]...
+//	ChessPgnValidator --book <file.bin> --probe <fen>...
+
+#include <Chess/Model/Board.h>
+#include <Chess/Model/Game.h>
+#include <Chess/Model/GameRecord.h>
+#include <Chess/Model/MemoryMappedFile.h>
+#include <Chess/Model/Move.h>
+#include <Chess/Model/Notation.h>
+#include <Chess/Model/OpeningBook.h>
+#include <Chess/Model/PgnReader.h>
+#include <Chess/Model/Position.h>
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <cstdlib>
+#include <iomanip>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace
+{
+	using namespace Chess::Model;
+
+	//Several chunks per thread even out threads that are handed chunks of long games
+	unsigned int constexpr CHUNKS_PER_THREAD = 8;
+
+	struct Options
+	{
+		std::string path;
+		std::string outputPath;
+		std::string bookPath;
+		std::uint32_t bookPlies = 16;
+		std::vector<std::string> probeFens;
+		bool isGameRecordFile = false;
+		unsigned int threads = std::max(1u, std::thread::hardware_concurrency());
+		std::size_t maxErrors = 20;
+	};
+
+	/// <summary>
+	/// A game that could not be replayed.
+	/// </summary>
+	struct GameError
+	{
+		//Which game of its chunk went wrong. It is turned into a game number once every chunk is counted
+		std::size_t gameInChunk;
+		unsigned int ply;
+		std::string san;
+		std::string reason;
+		std::string fen;
+	};
+
+	/// <summary>
+	/// A valid game waiting to be written to a game record file.
+	/// </summary>
+	struct ValidGame
+	{
+		std::string startFen;
+		std::vector<Move> moves;
+		GameResult result;
+	};
+
+	struct ChunkResult
+	{
+		std::uint64_t games = 0;
+		std::uint64_t moves = 0;
+		std::uint64_t invalidGames = 0;
+		std::vector<GameError> errors;
+		std::vector<ValidGame> validGames;
+
+		//The Polyglot key and move of each ply of the valid games that goes into the opening book
+		std::vector<std::pair<std::uint64_t, Move>> bookMoves;
+
+		void addError(std::size_t maxErrors, unsigned int ply, std::string_view san, std::string reason, std::string fen)
+		{
+			++invalidGames;
+			if (errors.size() < maxErrors)
+			{
+				errors.push_back({ games, ply, std::string(san), std::move(reason), std::move(fen) });
+			}
+		}
+	};
+
+	GameResult toGameResult(std::string_view result)
+	{
+		return result == "1-0" ? GameResult::WhiteWins
+			: result == "0-1" ? GameResult::BlackWins
+			: result == "1/2-1/2" ? GameResult::Draw
+			: GameResult::Unknown;
+	}
+
+	/// <summary>
+	/// Collects the opening moves of a valid game for the opening book.
+	/// </summary>
+	void addBookMoves(std::string_view startFen, std::vector<Move> const& moves, Options const& options, ChunkResult& result)
+	{
+		Board board(startFen);
+		for (std::size_t ply = 0; ply < moves.size() && ply < options.bookPlies; ++ply)
+		{
+			result.bookMoves.emplace_back(polyglotKey(board), moves[ply]);
+			UndoRecord undoRecord;
+			board.makeMove(moves[ply], undoRecord);
+		}
+	}
+
+	/// <summary>
+	/// Replays one PGN game from its starting position, recording the first move that cannot be made.
+	/// </summary>
+	void replayGame(Game& game, PgnGame const& pgnGame, Options const& options, ChunkResult& result)
+	{
+		std::string_view fen = pgnGame.getTag("FEN");
+		try
+		{
+			game.setFen(fen.empty() ? START_FEN : fen);
+		}
+		catch (std::invalid_argument const& e)
+		{
+			result.addError(options.maxErrors, 0, std::string_view(), std::string("malformed FEN tag: ") + e.what(), std::string(fen));
+			return;
+		}
+
+		std::vector<Move> moves;
+		std::size_t offset = 0;
+		std::string_view san;
+		while (pgnGame.readSan(offset, san))
+		{
+			Move move = parseSan(game.getBoard(), san);
+			if (move == Move() || !game.move(move))
+			{
+				result.addError(options.maxErrors, static_cast<unsigned int>(moves.size()), san, "malformed, ambiguous or illegal move", game.toFen());
+				return;
+			}
+			moves.push_back(move);
+		}
+
+		result.moves += moves.size();
+		if (!options.bookPath.empty())
+		{
+			addBookMoves(fen.empty() ? START_FEN : fen, moves, options, result);
+		}
+		if (!options.outputPath.empty())
+		{
+			result.validGames.push_back({ std::string(fen), std::move(moves), toGameResult(pgnGame.getTag("Result")) });
+		}
+	}
+
+	void replayChunk(std::string_view chunk, Options const& options, ChunkResult& result)
+	{
+		Game game;
+		PgnReader reader(chunk);
+		PgnGame pgnGame;
+		while (reader.readGame(pgnGame))
+		{
+			replayGame(game, pgnGame, options, result);
+			++result.games;
+		}
+	}
+
+	/// <summary>
+	/// Replays a range of games from a game record file. The moves were legal when they
+	/// were recorded, but they are checked again so that a corrupt file is caught.
+	/// </summary>
+	void replayRecordedGames(GameRecordReader const& reader, std::size_t firstGame, std::size_t lastGame, Options const& options, ChunkResult& result)
+	{
+		Game game;
+		for (std::size_t i = firstGame; i < lastGame; ++i, ++result.games)
+		{
+			RecordedGame recordedGame = reader.getGame(i);
+			try
+			{
+				game.setFen(recordedGame.startFen.empty() ? START_FEN : recordedGame.startFen);
+			}
+			catch (std::invalid_argument const& e)
+			{
+				result.addError(options.maxErrors, 0, std::string_view(), std::string("malformed starting position: ") + e.what(), std::string(recordedGame.startFen));
+				continue;
+			}
+
+			std::vector<Move> moves;
+			for (std::uint32_t ply = 0; ply < recordedGame.plyCount; ++ply)
+			{
+				if (!game.move(recordedGame.getMove(ply)))
+				{
+					result.addError(options.maxErrors, ply, "#" + std::to_string(recordedGame.getMove(ply).getData()), "illegal move", game.toFen());
+					break;
+				}
+				moves.push_back(recordedGame.getMove(ply));
+			}
+
+			result.moves += moves.size();
+			if (!options.bookPath.empty() && moves.size() == recordedGame.plyCount)
+			{
+				addBookMoves(recordedGame.startFen.empty() ? START_FEN : recordedGame.startFen, moves, options, result);
+			}
+		}
+	}
+
+	/// <summary>
+	/// Replays chunks on a pool of threads, each taking the next chunk that no other thread has taken.
+	/// </summary>
+	/// <returns>The number of threads used</returns>
+	template <typename ReplayChunk>
+	unsigned int replayChunks(std::size_t chunkCount, unsigned int threadCount, ReplayChunk const& replayChunk)
+	{
+		std::atomic<std::size_t> nextChunk(0);
+		auto worker = [chunkCount, &replayChunk, &nextChunk]()
+		{
+			for (std::size_t i = nextChunk++; i < chunkCount; i = nextChunk++)
+			{
+				replayChunk(i);
+			}
+		};
+
+		threadCount = std::max(1u, std::min<unsigned int>(threadCount, static_cast<unsigned int>(chunkCount)));
+		std::vector<std::thread> threads;
+		for (unsigned int i = 1; i < threadCount; ++i)
+		{
+			threads.emplace_back(worker);
+		}
+		worker();
+		for (std::thread& thread : threads)
+		{
+			thread.join();
+		}
+		return threadCount;
+	}
+
+	double elapsedSeconds(std::chrono::steady_clock::time_point start)
+	{
+		return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+	}
+
+	void writeOpeningBook(std::vector<ChunkResult> const& results, Options const& options)
+	{
+		if (options.bookPath.empty())
+		{
+			return;
+		}
+
+		OpeningBookWriter writer;
+		for (ChunkResult const& result : results)
+		{
+			for (auto const& [key, move] : result.bookMoves)
+			{
+				writer.addMove(key, move);
+			}
+		}
+		writer.write(options.bookPath);
+		std::cout << "Wrote the first " << options.bookPlies << " plies of the valid games to " << options.bookPath << "\n";
+	}
+
+	std::string toString(Move move)
+	{
+		Position from = toPosition(move.getFrom());
+		Position to = toPosition(move.getTo());
+
+		std::string text;
+		text += static_cast<char>('a' + from.file - 1);
+		text += static_cast<char>('0' + from.rank);
+		text += static_cast<char>('a' + to.file - 1);
+		text += static_cast<char>('0' + to.rank);
+
+		if (move.isPromotion())
+		{
+			char constexpr promotionSuffixes[] = { 'n', 'b', 'r', 'q' };
+			text += promotionSuffixes[static_cast<int>(move.getFlag()) & 0x3];
+		}
+		return text;
+	}
+
+	/// <summary>
+	/// Prints the Polyglot key and the book moves with their weights for each position to probe.
+	/// </summary>
+	void probeOpeningBook(Options const& options)
+	{
+		if (options.probeFens.empty())
+		{
+			return;
+		}
+
+		OpeningBook book(options.bookPath);
+		for (std::string const& fen : options.probeFens)
+		{
+			Board board(fen);
+			std::cout << fen << ": key " << std::hex << std::setfill('0') << std::setw(16) << polyglotKey(board)
+				<< std::dec << std::setfill(' ') << ":";
+			for (BookMove const& bookMove : book.findMoves(board))
+			{
+				std::cout << " " << toString(bookMove.move) << " (" << bookMove.weight << ")";
+			}
+			std::cout << "\n";
+		}
+	}
+
+	/// <summary>
+	/// Prints the errors and throughput of a run.
+	/// </summary>
+	/// <returns>The exit code, which is a failure if any game was invalid</returns>
+	int report(std::vector<ChunkResult> const& results, Options const& options, std::size_t bytes, double seconds, unsigned int threadCount)
+	{
+		ChunkResult total;
+		std::size_t reportedErrors = 0;
+		for (ChunkResult const& result : results)
+		{
+			for (GameError const& error : result.errors)
+			{
+				if (reportedErrors++ < options.maxErrors)
+				{
+					std::cout << "Game " << total.games + error.gameInChunk + 1;
+					if (!error.san.empty())
+					{
+						std::cout << ", ply " << error.ply + 1 << " (" << error.san << ")";
+					}
+					std::cout << ": " << error.reason << "\n\tin " << error.fen << "\n";
+				}
+			}
+			total.games += result.games;
+			total.moves += result.moves;
+			total.invalidGames += result.invalidGames;
+		}
+
+		double safeSeconds = std::max(seconds, 1e-9);
+		std::cout << "\nGames: " << total.games
+			<< "\nMoves: " << total.moves
+			<< "\nInvalid games: " << total.invalidGames
+			<< "\nTime: " << seconds << " s (" << threadCount << " thread(s), " << results.size() << " chunks)"
+			<< "\nThroughput: " << static_cast<std::uint64_t>(total.games / safeSeconds) << " games/s, "
+			<< static_cast<std::uint64_t>(total.moves / safeSeconds) << " moves/s, "
+			<< bytes / safeSeconds / (1024.0 * 1024.0) << " MB/s\n";
+
+		return total.invalidGames == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+	}
+
+	int runPgn(Options const& options)
+	{
+		auto start = std::chrono::steady_clock::now();
+
+		MemoryMappedFile file(options.path);
+		std::string_view text(reinterpret_cast<char const*>(file.getData()), file.getSize());
+		std::vector<std::string_view> chunks = PgnReader::splitIntoChunks(text, options.threads * CHUNKS_PER_THREAD);
+		std::vector<ChunkResult> results(chunks.size());
+
+		unsigned int threadCount = replayChunks(chunks.size(), options.threads, [&chunks, &results, &options](std::size_t i)
+		{
+			replayChunk(chunks[i], options, results[i]);
+		});
+		double seconds = elapsedSeconds(start);
+
+		if (!options.outputPath.empty())
+		{
+			//The chunks are in file order, so the valid games keep their order
+			GameRecordWriter writer(options.outputPath);
+			for (ChunkResult const& result : results)
+			{
+				for (ValidGame const& game : result.validGames)
+				{
+					writer.addGame(game.startFen, game.moves, game.result);
+				}
+			}
+			writer.finish();
+			std::cout << "Wrote the valid games to " << options.outputPath << "\n";
+		}
+		writeOpeningBook(results, options);
+
+		return report(results, options, text.size(), seconds, threadCount);
+	}
+
+	int runGameRecords(Options const& options)
+	{
+		auto start = std::chrono::steady_clock::now();
+
+		GameRecordReader reader(options.path);
+		std::size_t gameCount = reader.getGameCount();
+		std::size_t chunkCount = std::max<std::size_t>(1, std::min<std::size_t>(gameCount, options.threads * CHUNKS_PER_THREAD));
+		std::vector<ChunkResult> results(chunkCount);
+
+		unsigned int threadCount = replayChunks(chunkCount, options.threads, [&reader, &results, &options, gameCount, chunkCount](std::size_t i)
+		{
+			replayRecordedGames(reader, gameCount * i / chunkCount, gameCount * (i + 1) / chunkCount, options, results[i]);
+		});
+		double seconds = elapsedSeconds(start);
+
+		writeOpeningBook(results, options);
+		return report(results, options, MemoryMappedFile(options.path).getSize(), seconds, threadCount);
+	}
+
+	bool parseOptions(int argc, char* argv[], Options& options)
+	{
+		for (int i = 1; i < argc; ++i)
+		{
+			std::string argument = argv[i];
+			bool hasValue = i + 1 < argc;
+			if (argument == "--threads" && hasValue)
+			{
+				options.threads = std::max(1, std::atoi(argv[++i]));
+			}
+			else if (argument == "--max-errors" && hasValue)
+			{
+				options.maxErrors = static_cast<std::size_t>(std::max(0, std::atoi(argv[++i])));
+			}
+			else if (argument == "--output" && hasValue)
+			{
+				options.outputPath = argv[++i];
+			}
+			else if (argument == "--book" && hasValue)
+			{
+				options.bookPath = argv[++i];
+			}
+			else if (argument == "--probe" && hasValue)
+			{
+				options.probeFens.push_back(argv[++i]);
+			}
+			else if (argument == "--book-plies" && hasValue)
+			{
+				options.bookPlies = static_cast<std::uint32_t>(std::max(0, std::atoi(argv[++i])));
+			}
+			else if (argument == "--records" && hasValue && options.path.empty())
+			{
+				options.path = argv[++i];
+				options.isGameRecordFile = true;
+			}
+			else if (options.path.empty() && argument.rfind("--", 0) != 0)
+			{
+				options.path = argument;
+			}
+			else
+			{
+				return false;
+			}
+		}
+		bool isProbeOnly = options.path.empty() && !options.probeFens.empty();
+		return (!options.path.empty() || isProbeOnly)
+			&& (options.probeFens.empty() || !options.bookPath.empty())
+			&& !(options.isGameRecordFile && !options.outputPath.empty());
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	Options options;
+	if (!parseOptions(argc, argv, options))
+	{
+		std::cerr
+			<< "Usage: ChessPgnValidator <file.pgn> [--output <file.bin>] [--book <file.bin>] [--book-plies <n>] [--threads <n>] [--max-errors <n>] [--probe <fen>]...\n"
+			<< "       ChessPgnValidator --records <file.bin> [--book <file.bin>] [--book-plies <n>] [--threads <n>] [--max-errors <n>] [--probe <fen>]...\n"
+			<< "       ChessPgnValidator --book <file.bin> --probe <fen>...\n";
+		return EXIT_FAILURE;
+	}
+
+	try
+	{
+		int exitCode = options.path.empty() ? EXIT_SUCCESS
+			: options.isGameRecordFile ? runGameRecords(options)
+			: runPgn(options);
+
+		//The book is probed after the run so that a book written by the run can be probed
+		probeOpeningBook(options);
+		return exitCode;
+	}
+	catch (std::exception const& e)
+	{
+		std::cerr << e.what() << "\n";
+		return EXIT_FAILURE;
+	}
+}
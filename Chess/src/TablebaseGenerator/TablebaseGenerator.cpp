@@ -0,0 +1,135 @@
+// Author:	Liam Scholte
+// Created:	10/17/2026 10:52:36 PM
+// This file contains a command line tool that generates endgame tablebases.
+// Each material given is generated along with the smaller tables its captures
+// and promotions lead into, skipping any table already in the directory.
+// Positions can then be probed to check the tables against known results.
+//
+// Usage:
+//	ChessTablebaseGenerator <material>... [--directory <dir>] [--threads <n>] [--probe <fen>]...
+//
+// Material is written with each side's pieces after its king, for example KRvK or KQPvKR.
+
+#include <Chess/Model/Board.h>
+#include <Chess/Model/Tablebase.h>
+
+#include <algorithm>
+#include <chrono>
+#include <cstdlib>
+#include <filesystem>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace
+{
+	using namespace Chess::Model;
+
+	struct Options
+	{
+		std::vector<std::string> materials;
+		std::vector<std::string> fens;
+		std::string directory = ".";
+		unsigned int threads = std::max(1u, std::thread::hardware_concurrency());
+	};
+
+	bool parseOptions(int argc, char* argv[], Options& options)
+	{
+		for (int i = 1; i < argc; ++i)
+		{
+			std::string argument = argv[i];
+			bool hasValue = i + 1 < argc;
+			if (argument == "--threads" && hasValue)
+			{
+				options.threads = std::max(1, std::atoi(argv[++i]));
+			}
+			else if (argument == "--directory" && hasValue)
+			{
+				options.directory = argv[++i];
+			}
+			else if (argument == "--probe" && hasValue)
+			{
+				options.fens.push_back(argv[++i]);
+			}
+			else if (argument.rfind("--", 0) != 0)
+			{
+				options.materials.push_back(argument);
+			}
+			else
+			{
+				return false;
+			}
+		}
+		return !options.materials.empty() || !options.fens.empty();
+	}
+
+	void generate(Options const& options)
+	{
+		std::filesystem::create_directories(options.directory);
+		for (std::string const& material : options.materials)
+		{
+			auto start = std::chrono::steady_clock::now();
+			std::string name = Tablebase::generate(material, options.directory, options.threads);
+			double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+			std::cout << name << ": " << seconds << " s\n";
+		}
+	}
+
+	/// <summary>
+	/// Prints the outcome of each position to probe.
+	/// </summary>
+	/// <returns>True if every position was covered by the tables</returns>
+	bool probe(Options const& options)
+	{
+		if (options.fens.empty())
+		{
+			return true;
+		}
+
+		Tablebase tablebase(options.directory);
+		bool isEveryPositionCovered = true;
+		for (std::string const& fen : options.fens)
+		{
+			Board board(fen);
+			TablebaseResult result;
+			std::cout << fen << ": ";
+			if (!tablebase.probe(board, result))
+			{
+				std::cout << "not covered\n";
+				isEveryPositionCovered = false;
+				continue;
+			}
+
+			unsigned int moves = (result.pliesToMate + 1) / 2;
+			std::cout
+				<< (result.outcome > 0 ? "win in " + std::to_string(moves) + " moves"
+					: result.outcome < 0 ? "loss in " + std::to_string(moves) + " moves"
+					: std::string("draw"))
+				<< " (" << result.pliesToMate << " plies)\n";
+		}
+		return isEveryPositionCovered;
+	}
+}
+
+int main(int argc, char* argv[])
+{
+	Options options;
+	if (!parseOptions(argc, argv, options))
+	{
+		std::cerr << "Usage: ChessTablebaseGenerator <material>... [--directory <dir>] [--threads <n>] [--probe <fen>]...\n";
+		return EXIT_FAILURE;
+	}
+
+	try
+	{
+		generate(options);
+		return probe(options) ? EXIT_SUCCESS : EXIT_FAILURE;
+	}
+	catch (std::exception const& e)
+	{
+		std::cerr << e.what() << "\n";
+		return EXIT_FAILURE;
+	}
+}
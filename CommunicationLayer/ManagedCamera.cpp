@@ -97,4 +97,14 @@ void ManagedCamera::HandleLeftClick(float x, float y)
 void ManagedCamera::HandleRightClick()
 {
 	m_pCamera->handleRightClick();
+}
+
+bool ManagedCamera::UndoMove()
+{
+	return m_pCamera->undoMove();
+}
+
+bool ManagedCamera::RedoMove()
+{
+	return m_pCamera->redoMove();
 }
\ No newline at end of file
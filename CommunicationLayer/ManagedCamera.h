@@ -103,6 +103,10 @@ public:
 
 	void HandleRightClick();
 
+	bool UndoMove();
+
+	bool RedoMove();
+
 private:
 	Chess::ArView::Camera* m_pCamera;
 };
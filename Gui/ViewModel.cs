@@ -102,6 +102,16 @@ namespace Gui
             ReprojectionError = m_camera.GetReprojectionError();
         });
 
+        public ICommand UndoMoveCommand => new Command(() =>
+        {
+            m_camera.UndoMove();
+        });
+
+        public ICommand RedoMoveCommand => new Command(() =>
+        {
+            m_camera.RedoMove();
+        });
+
         public void HandleLeftClick(Point point)
         {
             m_camera.HandleLeftClick((float)point.X, (float)point.Y);